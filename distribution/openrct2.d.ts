@@ -503,9 +503,14 @@ declare global {
          */
         subscribe(hook: HookType, callback: Function): IDisposable;
 
-        subscribe(hook: "action.execute", callback: (e: GameActionEventArgs) => void): IDisposable;
+        /**
+         * Subscribes to the given action hook, optionally only for the given actions or players.
+         * The callback is not invoked, and no event arguments are created, for actions that do not match the filter.
+         * @param filter Optional filter for the actions and players to receive events for.
+         */
+        subscribe(hook: "action.execute", callback: (e: GameActionEventArgs) => void, filter?: ActionHookFilter): IDisposable;
         subscribe(hook: "action.location", callback: (e: ActionLocationArgs) => void): IDisposable;
-        subscribe(hook: "action.query", callback: (e: GameActionEventArgs) => void): IDisposable;
+        subscribe(hook: "action.query", callback: (e: GameActionEventArgs) => void, filter?: ActionHookFilter): IDisposable;
         subscribe(hook: "guest.generation", callback: (e: GuestGenerationArgs) => void): IDisposable;
         subscribe(hook: "interval.day", callback: () => void): IDisposable;
         subscribe(hook: "interval.tick", callback: () => void): IDisposable;
@@ -1345,6 +1350,22 @@ declare global {
         height: number;
     }
 
+    /**
+     * Restricts an action.query or action.execute subscription to specific actions or players.
+     * Omitted or empty lists match everything.
+     */
+    interface ActionHookFilter {
+        /**
+         * The names of the actions to receive events for, e.g. "ridesetprice" or a custom action id.
+         */
+        actions?: string[];
+
+        /**
+         * The ids of the players whose actions to receive events for.
+         */
+        players?: number[];
+    }
+
     interface GameActionEventArgs<T = object> {
         readonly player: number;
         readonly type: number;
@@ -1470,6 +1491,28 @@ declare global {
 
         getRide(id: number): Ride;
         getTile(x: number, y: number): Tile;
+
+        /**
+         * Reads a rectangular region of the map into packed typed arrays in a single call. This is
+         * much faster than iterating over {@link Tile.elements} for large areas.
+         * Tile i of the region is at (x + i % width, y + floor(i / width)).
+         * @param x0 The tile x coordinate of the first corner (inclusive).
+         * @param y0 The tile y coordinate of the first corner (inclusive).
+         * @param x1 The tile x coordinate of the opposite corner (inclusive).
+         * @param y1 The tile y coordinate of the opposite corner (inclusive).
+         * @param options The fields to read, all fields are read if omitted.
+         */
+        getRegion(x0: number, y0: number, x1: number, y1: number, options?: MapRegionOptions): MapRegion;
+
+        /**
+         * Writes the surface fields of the given region back to the map. Fields that are not set
+         * are left unchanged, element fields are ignored. Like other tile element setters this can
+         * only be called when the game state is mutable, e.g. from a custom action's execute
+         * handler, so a whole region can be changed with a single networked action.
+         * @param region The region to write, usually obtained from {@link getRegion}.
+         */
+        setRegion(region: MapRegion): void;
+
         getEntity(id: number): Entity;
         getAllEntities(type: EntityType): Entity[];
         /**
@@ -1496,6 +1539,54 @@ declare global {
         getTrackIterator(location: CoordsXY, elementIndex: number): TrackIterator | null;
     }
 
+    type MapRegionField =
+        "surfaceHeight" | "waterHeight" | "slope" | "surfaceStyle" | "ownership" |
+        "elementType" | "elementBaseHeight" | "elementClearanceHeight" | "elementRide";
+
+    interface MapRegionOptions {
+        fields?: MapRegionField[];
+    }
+
+    /**
+     * A rectangular region of the map stored as packed typed arrays.
+     * Surface fields have one entry per tile, element fields one entry per tile element.
+     */
+    interface MapRegion {
+        x: number;
+        y: number;
+        width: number;
+        height: number;
+
+        /**
+         * The base height of the surface element of each tile.
+         */
+        surfaceHeight?: Uint8Array;
+        waterHeight?: Uint16Array;
+        slope?: Uint8Array;
+        surfaceStyle?: Uint16Array;
+        ownership?: Uint8Array;
+
+        /**
+         * The index of the first element of each tile in the element fields, with one extra
+         * entry at the end. The elements of tile i are at [elementStart[i], elementStart[i + 1]).
+         * Present whenever an element field is requested.
+         */
+        elementStart?: Uint32Array;
+
+        /**
+         * The type of each element: 0 surface, 1 footpath, 2 track, 3 small_scenery,
+         * 4 entrance, 5 wall, 6 large_scenery, 7 banner.
+         */
+        elementType?: Uint8Array;
+        elementBaseHeight?: Uint8Array;
+        elementClearanceHeight?: Uint8Array;
+
+        /**
+         * The ride of each track, entrance and queue element, 65535 for other elements.
+         */
+        elementRide?: Uint16Array;
+    }
+
     type TileElementType =
         "surface" | "footpath" | "track" | "small_scenery" | "wall" | "entrance" | "large_scenery" | "banner";
 
@@ -5286,12 +5377,47 @@ declare global {
 
     interface Profiler {
         getData(): ProfiledFunction[];
+
+        /**
+         * Gets the time each plug-in has spent in its hook and interval callbacks. This is
+         * recorded regardless of whether the profiler is started.
+         */
+        getPluginData(): ProfiledPlugin[];
         start(): void;
         stop(): void;
+
+        /**
+         * Resets the profiler data and the plug-in timings.
+         */
         reset(): void;
         readonly enabled: boolean;
     }
 
+    interface ProfiledPlugin {
+        readonly name: string;
+        readonly calls: ProfiledPluginCall[];
+    }
+
+    interface ProfiledPluginCall {
+        /**
+         * The hook, e.g. "interval.tick", or "interval" for setInterval and setTimeout callbacks.
+         */
+        readonly name: string;
+        readonly callCount: number;
+
+        /**
+         * The number of interval callbacks postponed to the next update because the plug-in
+         * exceeded the time budget set in the configuration.
+         */
+        readonly deferredCount: number;
+
+        /**
+         * Times are in microseconds and include any nested callbacks.
+         */
+        readonly maxTime: number;
+        readonly totalTime: number;
+    }
+
     interface ProfiledFunction {
         readonly name: string;
         readonly callCount: number;
@@ -473,6 +473,14 @@ public:
                 WindowGuestListRefreshList();
                 break;
 
+            case INTENT_ACTION_INVALIDATE_GUEST_NAMES:
+                WindowGuestListInvalidateNames();
+                break;
+
+            case INTENT_ACTION_REMOVE_GUEST_NAME:
+                WindowGuestListRemoveName(EntityId::FromUnderlying(intent.GetUIntExtra(INTENT_EXTRA_PEEP)));
+                break;
+
             case INTENT_ACTION_REFRESH_STAFF_LIST:
             {
                 WindowStaffListRefresh();
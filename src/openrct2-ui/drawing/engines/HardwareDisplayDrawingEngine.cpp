@@ -10,12 +10,14 @@
 #include "DrawingEngineFactory.hpp"
 
 #include <SDL.h>
+#include <array>
 #include <cmath>
 #include <memory>
 #include <openrct2/Diagnostic.h>
 #include <openrct2/Game.h>
 #include <openrct2/config/Config.h>
 #include <openrct2/core/Guard.hpp>
+#include <openrct2/drawing/Drawing.h>
 #include <openrct2/drawing/IDrawingEngine.h>
 #include <openrct2/drawing/LightFX.h>
 #include <openrct2/drawing/X8DrawingEngine.h>
@@ -49,6 +51,7 @@ private:
     bool _useVsync = true;
 
     std::vector<uint32_t> _dirtyVisualsTime;
+    std::vector<PresentRect> _presentRects;
 
     bool smoothNN = false;
 
@@ -186,10 +189,16 @@ public:
     {
         if (_screenTextureFormat != nullptr)
         {
+            // The animated water entries change nearly every frame, only the parts of the screen using them need
+            // converting again.
+            std::array<bool, 256> changed{};
             for (int32_t i = 0; i < 256; i++)
             {
-                _paletteHWMapped[i] = SDL_MapRGB(_screenTextureFormat, palette[i].Red, palette[i].Green, palette[i].Blue);
+                const auto colour = SDL_MapRGB(_screenTextureFormat, palette[i].Red, palette[i].Green, palette[i].Blue);
+                changed[i] = colour != _paletteHWMapped[i];
+                _paletteHWMapped[i] = colour;
             }
+            _presentGrid.InvalidatePaletteEntries(_bits, _pitch, changed);
 
             if (Config::Get().general.EnableLightFx)
             {
@@ -232,6 +241,7 @@ protected:
 private:
     void Display()
     {
+        _presentGrid.TakeRects(_presentRects);
         if (Config::Get().general.EnableLightFx)
         {
             void* pixels;
@@ -241,6 +251,12 @@ private:
                 LightFx::RenderToTexture(pixels, pitch, _bits, _width, _height, _paletteHWMapped, _lightPaletteHWMapped);
                 SDL_UnlockTexture(_screenTexture);
             }
+            // The lit texture differs from the plain buffer everywhere, refresh all of it once lighting is turned off.
+            _presentGrid.InvalidateAll();
+        }
+        else if (CanCopyRectsToTexture())
+        {
+            CopyRectsToTexture(_screenTexture, _presentRects, _paletteHWMapped);
         }
         else
         {
@@ -279,6 +295,44 @@ private:
         }
     }
 
+    /**
+     * Only worth it when less than half of the screen changed, a single lock of the whole texture is cheaper than many
+     * small ones otherwise.
+     */
+    bool CanCopyRectsToTexture() const
+    {
+        if (SDL_BYTESPERPIXEL(_screenTextureFormat->format) != 4)
+            return false;
+
+        uint64_t changedArea = 0;
+        for (const auto& rect : _presentRects)
+        {
+            changedArea += static_cast<uint64_t>(rect.Width) * rect.Height;
+        }
+        return changedArea * 2 < static_cast<uint64_t>(_width) * _height;
+    }
+
+    // Converts and uploads only the given areas, SDL does not keep the old contents of a locked area so each one is
+    // overwritten completely.
+    void CopyRectsToTexture(SDL_Texture* texture, const std::vector<PresentRect>& rects, const uint32_t* palette)
+    {
+        for (const auto& rect : rects)
+        {
+            SDL_Rect lockRect = { static_cast<int32_t>(rect.X), static_cast<int32_t>(rect.Y),
+                                  static_cast<int32_t>(rect.Width), static_cast<int32_t>(rect.Height) };
+            void* pixels;
+            int32_t pitch;
+            if (SDL_LockTexture(texture, &lockRect, &pixels, &pitch) == 0)
+            {
+                const auto width = static_cast<int32_t>(rect.Width);
+                PaletteLookupFn(
+                    width, static_cast<int32_t>(rect.Height), _bits + rect.Y * _pitch + rect.X, static_cast<uint32_t*>(pixels),
+                    static_cast<int32_t>(_pitch) - width, (pitch / 4) - width, palette);
+                SDL_UnlockTexture(texture);
+            }
+        }
+    }
+
     void CopyBitsToTexture(SDL_Texture* texture, uint8_t* src, int32_t width, int32_t height, const uint32_t* palette)
     {
         void* pixels;
@@ -288,11 +342,7 @@ private:
             int32_t padding = pitch - (width * 4);
             if (pitch == width * 4)
             {
-                uint32_t* dst = static_cast<uint32_t*>(pixels);
-                for (int32_t i = width * height; i > 0; i--)
-                {
-                    *dst++ = palette[*src++];
-                }
+                PaletteLookupFn(width, height, src, static_cast<uint32_t*>(pixels), 0, 0, palette);
             }
             else
             {
@@ -11,6 +11,7 @@
 
 #include <SDL.h>
 #include <algorithm>
+#include <array>
 #include <openrct2/Diagnostic.h>
 #include <openrct2/Game.h>
 #include <openrct2/config/Config.h>
@@ -18,6 +19,7 @@
 #include <openrct2/drawing/IDrawingEngine.h>
 #include <openrct2/drawing/X8DrawingEngine.h>
 #include <openrct2/ui/UiContext.h>
+#include <vector>
 
 using namespace OpenRCT2;
 using namespace OpenRCT2::Drawing;
@@ -31,6 +33,8 @@ private:
     SDL_Surface* _surface = nullptr;
     SDL_Surface* _RGBASurface = nullptr;
     SDL_Palette* _palette = nullptr;
+    SDL_Surface* _lastWindowSurface = nullptr;
+    std::vector<PresentRect> _presentRects;
 
 public:
     explicit SoftwareDrawingEngine(const std::shared_ptr<IUiContext>& uiContext)
@@ -83,14 +87,20 @@ public:
         if (windowSurface != nullptr && _palette != nullptr)
         {
             SDL_Colour colours[256];
+            std::array<bool, 256> changed{};
             for (int32_t i = 0; i < 256; i++)
             {
                 colours[i].r = palette[i].Red;
                 colours[i].g = palette[i].Green;
                 colours[i].b = palette[i].Blue;
                 colours[i].a = palette[i].Alpha;
+
+                const auto& previous = _palette->colors[i];
+                changed[i] = previous.r != colours[i].r || previous.g != colours[i].g || previous.b != colours[i].b
+                    || previous.a != colours[i].a;
             }
             SDL_SetPaletteColors(_palette, colours, 0, 256);
+            _presentGrid.InvalidatePaletteEntries(_bits, _pitch, changed);
         }
     }
 
@@ -102,6 +112,15 @@ public:
 private:
     void Display()
     {
+        // A new window surface (e.g. after a resize) has none of the previous frames on it.
+        SDL_Surface* windowSurface = SDL_GetWindowSurface(_window);
+        if (windowSurface != _lastWindowSurface)
+        {
+            _lastWindowSurface = windowSurface;
+            _presentGrid.InvalidateAll();
+        }
+        _presentGrid.TakeRects(_presentRects);
+
         // Lock the surface before setting its pixels
         if (SDL_MUSTLOCK(_surface))
         {
@@ -112,8 +131,16 @@ private:
             }
         }
 
-        // Copy pixels from the virtual screen buffer to the surface
-        std::copy_n(_bits, _surface->pitch * _surface->h, static_cast<uint8_t*>(_surface->pixels));
+        // Copy the changed pixels from the virtual screen buffer to the surface
+        auto* pixels = static_cast<uint8_t*>(_surface->pixels);
+        for (const auto& rect : _presentRects)
+        {
+            for (uint32_t y = rect.Y; y < rect.Y + rect.Height; y++)
+            {
+                const auto offset = y * _surface->pitch + rect.X;
+                std::copy_n(_bits + offset, rect.Width, pixels + offset);
+            }
+        }
 
         // Unlock the surface
         if (SDL_MUSTLOCK(_surface))
@@ -128,26 +155,17 @@ private:
         // Copy the surface to the window
         if (Config::Get().general.WindowScale == 1 || Config::Get().general.WindowScale <= 0)
         {
-            SDL_Surface* windowSurface = SDL_GetWindowSurface(_window);
-            if (SDL_BlitSurface(_surface, nullptr, windowSurface, nullptr))
-            {
-                LOG_FATAL("SDL_BlitSurface %s", SDL_GetError());
-                exit(1);
-            }
+            BlitPresentRects(windowSurface);
         }
         else
 #endif
         {
             // first blit to rgba surface to change the pixel format
-            if (SDL_BlitSurface(_surface, nullptr, _RGBASurface, nullptr))
-            {
-                LOG_FATAL("SDL_BlitSurface %s", SDL_GetError());
-                exit(1);
-            }
+            BlitPresentRects(_RGBASurface);
 
             // then scale to window size. Without changing to RGBA first, SDL complains
             // about blit configurations being incompatible.
-            if (SDL_BlitScaled(_RGBASurface, nullptr, SDL_GetWindowSurface(_window), nullptr))
+            if (SDL_BlitScaled(_RGBASurface, nullptr, windowSurface, nullptr))
             {
                 LOG_FATAL("SDL_BlitScaled %s", SDL_GetError());
                 exit(1);
@@ -159,6 +177,22 @@ private:
             exit(1);
         }
     }
+
+    // Converts only the areas that changed since the last frame to the destination's pixel format.
+    void BlitPresentRects(SDL_Surface* dst)
+    {
+        for (const auto& rect : _presentRects)
+        {
+            SDL_Rect srcRect = { static_cast<int32_t>(rect.X), static_cast<int32_t>(rect.Y), static_cast<int32_t>(rect.Width),
+                                 static_cast<int32_t>(rect.Height) };
+            SDL_Rect dstRect = srcRect;
+            if (SDL_BlitSurface(_surface, &srcRect, dst, &dstRect))
+            {
+                LOG_FATAL("SDL_BlitSurface %s", SDL_GetError());
+                exit(1);
+            }
+        }
+    }
 };
 
 std::unique_ptr<IDrawingEngine> OpenRCT2::Ui::CreateSoftwareDrawingEngine(const std::shared_ptr<IUiContext>& uiContext)
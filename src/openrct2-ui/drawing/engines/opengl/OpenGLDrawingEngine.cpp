@@ -114,7 +114,8 @@ public:
     void DrawSpriteSolid(DrawPixelInfo& dpi, const ImageId image, int32_t x, int32_t y, uint8_t colour) override;
     void DrawGlyph(DrawPixelInfo& dpi, const ImageId image, int32_t x, int32_t y, const PaletteMap& palette) override;
     void DrawTTFBitmap(
-        DrawPixelInfo& dpi, TextDrawInfo* info, TTFSurface* surface, int32_t x, int32_t y, uint8_t hintingThreshold) override;
+        DrawPixelInfo& dpi, TextDrawInfo* info, const TTFSurface* surface, int32_t x, int32_t y,
+        uint8_t hintingThreshold) override;
 
     void FlushCommandBuffers();
 
@@ -976,7 +977,7 @@ void OpenGLDrawingContext::DrawGlyph(DrawPixelInfo& dpi, const ImageId image, in
 }
 
 void OpenGLDrawingContext::DrawTTFBitmap(
-    DrawPixelInfo& dpi, TextDrawInfo* info, TTFSurface* surface, int32_t x, int32_t y, uint8_t hintingThreshold)
+    DrawPixelInfo& dpi, TextDrawInfo* info, const TTFSurface* surface, int32_t x, int32_t y, uint8_t hintingThreshold)
 {
     #ifndef NO_TTF
     auto baseId = static_cast<uint32_t>(0x7FFFF) - 1024;
@@ -1301,4 +1301,18 @@ namespace OpenRCT2::Ui
             }
         }
     }
+
+    ScrollRowRange WidgetScrollGetVisibleRows(const DrawPixelInfo& dpi, int32_t rowHeight, size_t numRows, int32_t top)
+    {
+        // Rows are drawn one pixel taller than their height (highlights include the bottom edge), so a row whose
+        // bottom edge touches the top of the area is still included.
+        const auto firstY = int64_t{ dpi.y } - top - 1;
+        const auto lastY = int64_t{ dpi.y } + dpi.height - 1 - top;
+        if (lastY < 0 || numRows == 0)
+            return { 0, 0 };
+
+        const auto start = firstY < 0 ? 0 : static_cast<size_t>(firstY / rowHeight);
+        const auto end = static_cast<size_t>(lastY / rowHeight) + 1;
+        return { std::min(start, numRows), std::min(end, numRows) };
+    }
 } // namespace OpenRCT2::Ui
@@ -190,4 +190,13 @@ namespace OpenRCT2::Ui
     void WidgetProgressBarSetNewPercentage(Widget& widget, uint8_t newPercentage);
 
     void WidgetScrollUpdateThumbs(WindowBase& w, WidgetIndex widget_index);
+
+    // Rows [Start, End) of a list with fixed height rows that are at least partly inside the area being drawn.
+    struct ScrollRowRange
+    {
+        size_t Start;
+        size_t End;
+    };
+
+    ScrollRowRange WidgetScrollGetVisibleRows(const DrawPixelInfo& dpi, int32_t rowHeight, size_t numRows, int32_t top = 0);
 } // namespace OpenRCT2::Ui
@@ -28,6 +28,8 @@
 #include <openrct2/sprites.h>
 #include <openrct2/ui/WindowManager.h>
 #include <openrct2/world/Park.h>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 using namespace OpenRCT2::Numerics;
@@ -128,7 +130,7 @@ namespace OpenRCT2::Ui::Windows
             using CompareFunc = bool (*)(const GuestItem&, const GuestItem&);
 
             EntityId Id;
-            char Name[256];
+            std::string Name;
         };
 
         static constexpr uint8_t SUMMARISED_GUEST_ROW_HEIGHT = kScrollableRowHeight + 11;
@@ -154,6 +156,10 @@ namespace OpenRCT2::Ui::Windows
         std::vector<GuestItem> _guestList;
         std::optional<size_t> _highlightedIndex;
 
+        // Formatted guest names by entity id, cleared whenever a name may have changed. Refreshing the list after
+        // guests enter or leave the park then only needs to format the names of new guests.
+        std::unordered_map<uint16_t, std::string> _guestNames;
+
         uint32_t _tabAnimationIndex{};
 
     public:
@@ -264,6 +270,11 @@ namespace OpenRCT2::Ui::Windows
             }
         }
 
+        void OnLanguageChange() override
+        {
+            InvalidateNames();
+        }
+
         void OnUpdate() override
         {
             if (_lastFindGroupsWait != 0)
@@ -556,20 +567,15 @@ namespace OpenRCT2::Ui::Windows
             {
                 case TabId::Individual:
                 {
-                    auto i = screenCoords.y / kScrollableRowHeight;
-                    i += static_cast<int32_t>(_selectedPage * GUESTS_PER_PAGE);
-                    for (const auto& guestItem : _guestList)
+                    auto i = static_cast<size_t>(screenCoords.y / kScrollableRowHeight);
+                    i += _selectedPage * GUESTS_PER_PAGE;
+                    if (i < _guestList.size())
                     {
-                        if (i == 0)
+                        auto guest = GetEntity<Guest>(_guestList[i].Id);
+                        if (guest != nullptr)
                         {
-                            auto guest = GetEntity<Guest>(guestItem.Id);
-                            if (guest != nullptr)
-                            {
-                                GuestOpen(guest);
-                            }
-                            break;
+                            GuestOpen(guest);
                         }
-                        i--;
                     }
                     break;
                 }
@@ -634,18 +640,28 @@ namespace OpenRCT2::Ui::Windows
                     if (!GuestShouldBeVisible(*peep))
                         continue;
 
-                    auto& item = _guestList.emplace_back();
-                    item.Id = peep->Id;
-
-                    Formatter ft;
-                    peep->FormatNameTo(ft);
-                    OpenRCT2::FormatStringLegacy(item.Name, sizeof(item.Name), STR_STRINGID, ft.Data());
+                    _guestList.push_back({ peep->Id, GetGuestName(*peep) });
                 }
 
                 std::sort(_guestList.begin(), _guestList.end(), GetGuestCompareFunc());
             }
         }
 
+        void InvalidateNames()
+        {
+            _guestNames.clear();
+            RefreshList();
+            Invalidate();
+        }
+
+        // For a guest that left the park, whose id can be given to a new guest.
+        void RemoveName(EntityId guestId)
+        {
+            _guestNames.erase(guestId.ToUnderlying());
+            RefreshList();
+            Invalidate();
+        }
+
     private:
         void DrawTabImages(DrawPixelInfo& dpi)
         {
@@ -666,68 +682,65 @@ namespace OpenRCT2::Ui::Windows
 
         void DrawScrollIndividual(DrawPixelInfo& dpi)
         {
-            size_t index = 0;
-            auto y = static_cast<int32_t>(_selectedPage) * -GUEST_PAGE_HEIGHT;
-            for (const auto& guestItem : _guestList)
+            auto pageTop = static_cast<int32_t>(_selectedPage) * -GUEST_PAGE_HEIGHT;
+            auto rows = WidgetScrollGetVisibleRows(dpi, kScrollableRowHeight, _guestList.size(), pageTop);
+            for (auto index = rows.Start; index < rows.End; index++)
             {
-                // Check if y is beyond the scroll control
-                if (y + kScrollableRowHeight + 1 >= -0x7FFF && y + kScrollableRowHeight + 1 > dpi.y && y < 0x7FFF
-                    && y < dpi.y + dpi.height)
-                {
-                    // Highlight backcolour and text colour (format)
-                    StringId format = STR_BLACK_STRING;
-                    if (index == _highlightedIndex)
-                    {
-                        GfxFilterRect(dpi, { 0, y, 800, y + kScrollableRowHeight - 1 }, FilterPaletteID::PaletteDarken1);
-                        format = STR_WINDOW_COLOUR_2_STRINGID;
-                    }
+                const auto& guestItem = _guestList[index];
+                auto y = pageTop + static_cast<int32_t>(index) * kScrollableRowHeight;
 
-                    // Guest name
-                    auto peep = GetEntity<Guest>(guestItem.Id);
-                    if (peep == nullptr)
-                    {
-                        continue;
-                    }
-                    auto ft = Formatter();
-                    peep->FormatNameTo(ft);
-                    DrawTextEllipsised(dpi, { 0, y }, 113, format, ft);
+                // Highlight backcolour and text colour (format)
+                StringId format = STR_BLACK_STRING;
+                if (index == _highlightedIndex)
+                {
+                    GfxFilterRect(dpi, { 0, y, 800, y + kScrollableRowHeight - 1 }, FilterPaletteID::PaletteDarken1);
+                    format = STR_WINDOW_COLOUR_2_STRINGID;
+                }
 
-                    switch (_selectedView)
-                    {
-                        case GuestViewType::Actions:
-                            // Guest face
-                            GfxDrawSprite(dpi, ImageId(GetPeepFaceSpriteSmall(peep)), { 118, y + 1 });
+                // Guest name
+                auto peep = GetEntity<Guest>(guestItem.Id);
+                if (peep == nullptr)
+                {
+                    continue;
+                }
+                auto ft = Formatter();
+                ft.Add<StringId>(STR_STRING);
+                ft.Add<const char*>(guestItem.Name.c_str());
+                DrawTextEllipsised(dpi, { 0, y }, 113, format, ft);
 
-                            // Tracking icon
-                            if (peep->PeepFlags & PEEP_FLAGS_TRACKING)
-                                GfxDrawSprite(dpi, ImageId(STR_ENTER_SELECTION_SIZE), { 112, y + 1 });
+                switch (_selectedView)
+                {
+                    case GuestViewType::Actions:
+                        // Guest face
+                        GfxDrawSprite(dpi, ImageId(GetPeepFaceSpriteSmall(peep)), { 118, y + 1 });
+
+                        // Tracking icon
+                        if (peep->PeepFlags & PEEP_FLAGS_TRACKING)
+                            GfxDrawSprite(dpi, ImageId(STR_ENTER_SELECTION_SIZE), { 112, y + 1 });
+
+                        // Action
+                        ft = Formatter();
+                        peep->FormatActionTo(ft);
+                        DrawTextEllipsised(dpi, { 133, y }, 314, format, ft);
+                        break;
+                    case GuestViewType::Thoughts:
+                        // For each thought
+                        for (const auto& thought : peep->Thoughts)
+                        {
+                            if (thought.type == PeepThoughtType::None)
+                                break;
+                            if (thought.freshness == 0)
+                                continue;
+                            if (thought.freshness > 5)
+                                break;
 
-                            // Action
                             ft = Formatter();
-                            peep->FormatActionTo(ft);
-                            DrawTextEllipsised(dpi, { 133, y }, 314, format, ft);
-                            break;
-                        case GuestViewType::Thoughts:
-                            // For each thought
-                            for (const auto& thought : peep->Thoughts)
-                            {
-                                if (thought.type == PeepThoughtType::None)
-                                    break;
-                                if (thought.freshness == 0)
-                                    continue;
-                                if (thought.freshness > 5)
-                                    break;
-
-                                ft = Formatter();
-                                PeepThoughtSetFormatArgs(&thought, ft);
-                                DrawTextEllipsised(dpi, { 118, y }, 329, format, ft, { FontStyle::Small });
-                                break;
-                            }
+                            PeepThoughtSetFormatArgs(&thought, ft);
+                            DrawTextEllipsised(dpi, { 118, y }, 329, format, ft, { FontStyle::Small });
                             break;
-                    }
+                        }
+                        break;
                 }
-                y += kScrollableRowHeight;
-                index++;
             }
         }
 
@@ -790,12 +803,7 @@ namespace OpenRCT2::Ui::Windows
 
             if (!_filterName.empty())
             {
-                char name[256]{};
-
-                Formatter ft;
-                peep.FormatNameTo(ft);
-                OpenRCT2::FormatStringLegacy(name, sizeof(name), STR_STRINGID, ft.Data());
-                if (!String::contains(name, _filterName.c_str(), true))
+                if (!String::contains(GetGuestName(peep).c_str(), _filterName.c_str(), true))
                 {
                     return false;
                 }
@@ -804,6 +812,18 @@ namespace OpenRCT2::Ui::Windows
             return true;
         }
 
+        const std::string& GetGuestName(const Guest& peep)
+        {
+            auto [it, inserted] = _guestNames.try_emplace(peep.Id.ToUnderlying());
+            if (inserted)
+            {
+                Formatter ft;
+                peep.FormatNameTo(ft);
+                it->second = OpenRCT2::FormatStringIDLegacy(STR_STRINGID, ft.Data());
+            }
+            return it->second;
+        }
+
         bool IsPeepInFilter(const Guest& peep)
         {
             auto guestViewType = _selectedFilter == GuestFilterType::Guests ? GuestViewType::Actions : GuestViewType::Thoughts;
@@ -958,7 +978,7 @@ namespace OpenRCT2::Ui::Windows
                     }
                 }
             }
-            return String::logicalCmp(a.Name, b.Name) < 0;
+            return String::logicalCmp(a.Name.c_str(), b.Name.c_str()) < 0;
         }
 
         static GuestItem::CompareFunc GetGuestCompareFunc()
@@ -1001,4 +1021,24 @@ namespace OpenRCT2::Ui::Windows
             static_cast<GuestListWindow*>(w)->RefreshList();
         }
     }
+
+    void WindowGuestListInvalidateNames()
+    {
+        auto* windowMgr = GetWindowManager();
+        auto* w = windowMgr->FindByClass(WindowClass::GuestList);
+        if (w != nullptr)
+        {
+            static_cast<GuestListWindow*>(w)->InvalidateNames();
+        }
+    }
+
+    void WindowGuestListRemoveName(EntityId guestId)
+    {
+        auto* windowMgr = GetWindowManager();
+        auto* w = windowMgr->FindByClass(WindowClass::GuestList);
+        if (w != nullptr)
+        {
+            static_cast<GuestListWindow*>(w)->RemoveName(guestId);
+        }
+    }
 } // namespace OpenRCT2::Ui::Windows
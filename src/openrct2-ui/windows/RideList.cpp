@@ -546,9 +546,11 @@ namespace OpenRCT2::Ui::Windows
                 dpi, { dpiCoords, dpiCoords + ScreenCoordsXY{ dpi.width, dpi.height } },
                 ColourMapA[colours[1].colour].mid_light);
 
-            auto y = 0;
-            for (size_t i = 0; i < _rideList.size(); i++)
+            auto rows = WidgetScrollGetVisibleRows(dpi, kScrollableRowHeight, _rideList.size());
+            for (auto i = rows.Start; i < rows.End; i++)
             {
+                auto y = static_cast<int32_t>(i) * kScrollableRowHeight;
+
                 StringId format = STR_BLACK_STRING;
                 if (_quickDemolishMode)
                     format = STR_RED_STRINGID;
@@ -748,7 +750,6 @@ namespace OpenRCT2::Ui::Windows
                     ft.Add<StringId>(formatSecondary);
                 }
                 DrawTextEllipsised(dpi, { 160, y - 1 }, 157, format, ft);
-                y += kScrollableRowHeight;
             }
         }
 
@@ -355,30 +355,25 @@ namespace OpenRCT2::Ui::Windows
 
         void OnScrollMouseDown(int32_t scrollIndex, const ScreenCoordsXY& screenCoords) override
         {
-            int32_t i = screenCoords.y / kScrollableRowHeight;
-            for (const auto& entry : _staffList)
+            const auto i = screenCoords.y / kScrollableRowHeight;
+            if (i < 0 || static_cast<size_t>(i) >= _staffList.size())
+                return;
+
+            const auto& entry = _staffList[i];
+            if (_quickFireMode)
+            {
+                auto staffFireAction = StaffFireAction(entry.Id);
+                GameActions::Execute(&staffFireAction);
+            }
+            else
             {
-                if (i == 0)
+                auto peep = GetEntity<Staff>(entry.Id);
+                if (peep != nullptr)
                 {
-                    if (_quickFireMode)
-                    {
-                        auto staffFireAction = StaffFireAction(entry.Id);
-                        GameActions::Execute(&staffFireAction);
-                    }
-                    else
-                    {
-                        auto peep = GetEntity<Staff>(entry.Id);
-                        if (peep != nullptr)
-                        {
-                            auto intent = Intent(WindowClass::Peep);
-                            intent.PutExtra(INTENT_EXTRA_PEEP, peep);
-                            ContextOpenIntent(&intent);
-                        }
-                    }
-                    break;
+                    auto intent = Intent(WindowClass::Peep);
+                    intent.PutExtra(INTENT_EXTRA_PEEP, peep);
+                    ContextOpenIntent(&intent);
                 }
-
-                i--;
             }
         }
 
@@ -395,76 +390,67 @@ namespace OpenRCT2::Ui::Windows
             const int32_t actionColumnSize = nonIconSpace * 0.58;
             const int32_t actionOffset = widgets[WIDX_STAFF_LIST_LIST].right - actionColumnSize - 15;
 
-            auto y = 0;
-            size_t i = 0;
-            for (const auto& entry : _staffList)
+            auto rows = WidgetScrollGetVisibleRows(dpi, kScrollableRowHeight, _staffList.size());
+            for (auto i = rows.Start; i < rows.End; i++)
             {
-                if (y > dpi.y + dpi.height)
+                const auto& entry = _staffList[i];
+                auto y = static_cast<int32_t>(i) * kScrollableRowHeight;
+
+                const auto* peep = GetEntity<Staff>(entry.Id);
+                if (peep == nullptr)
                 {
-                    break;
+                    continue;
                 }
 
-                if (y + 11 >= dpi.y)
+                StringId format = STR_BLACK_STRING;
+                if (_quickFireMode)
+                    format = STR_RED_STRINGID;
+
+                if (i == _highlightedIndex)
                 {
-                    const auto* peep = GetEntity<Staff>(entry.Id);
-                    if (peep == nullptr)
-                    {
-                        continue;
-                    }
+                    GfxFilterRect(dpi, { 0, y, 800, y + (kScrollableRowHeight - 1) }, FilterPaletteID::PaletteDarken1);
 
-                    StringId format = STR_BLACK_STRING;
+                    format = STR_WINDOW_COLOUR_2_STRINGID;
                     if (_quickFireMode)
-                        format = STR_RED_STRINGID;
-
-                    if (i == _highlightedIndex)
-                    {
-                        GfxFilterRect(dpi, { 0, y, 800, y + (kScrollableRowHeight - 1) }, FilterPaletteID::PaletteDarken1);
+                        format = STR_LIGHTPINK_STRINGID;
+                }
 
-                        format = STR_WINDOW_COLOUR_2_STRINGID;
-                        if (_quickFireMode)
-                            format = STR_LIGHTPINK_STRINGID;
-                    }
+                auto ft = Formatter();
+                peep->FormatNameTo(ft);
+                DrawTextEllipsised(dpi, { 0, y }, nameColumnSize, format, ft);
 
-                    auto ft = Formatter();
-                    peep->FormatNameTo(ft);
-                    DrawTextEllipsised(dpi, { 0, y }, nameColumnSize, format, ft);
+                ft = Formatter();
+                peep->FormatActionTo(ft);
+                DrawTextEllipsised(dpi, { actionOffset, y }, actionColumnSize, format, ft);
 
-                    ft = Formatter();
-                    peep->FormatActionTo(ft);
-                    DrawTextEllipsised(dpi, { actionOffset, y }, actionColumnSize, format, ft);
+                // True if a patrol path is set for the worker
+                if (peep->HasPatrolArea())
+                {
+                    GfxDrawSprite(dpi, ImageId(SPR_STAFF_PATROL_PATH), { nameColumnSize + 5, y });
+                }
 
-                    // True if a patrol path is set for the worker
-                    if (peep->HasPatrolArea())
-                    {
-                        GfxDrawSprite(dpi, ImageId(SPR_STAFF_PATROL_PATH), { nameColumnSize + 5, y });
-                    }
+                auto staffOrderIcon_x = nameColumnSize + 20;
+                if (peep->AssignedStaffType != StaffType::Entertainer)
+                {
+                    auto staffOrders = peep->StaffOrders;
+                    auto staffOrderSprite = GetStaffOrderBaseSprite(GetSelectedStaffType());
 
-                    auto staffOrderIcon_x = nameColumnSize + 20;
-                    if (peep->AssignedStaffType != StaffType::Entertainer)
+                    while (staffOrders != 0)
                     {
-                        auto staffOrders = peep->StaffOrders;
-                        auto staffOrderSprite = GetStaffOrderBaseSprite(GetSelectedStaffType());
-
-                        while (staffOrders != 0)
+                        if (staffOrders & 1)
                         {
-                            if (staffOrders & 1)
-                            {
-                                GfxDrawSprite(dpi, ImageId(staffOrderSprite), { staffOrderIcon_x, y });
-                            }
-                            staffOrders = staffOrders >> 1;
-                            staffOrderIcon_x += 9;
-                            // TODO: Remove sprite ID addition
-                            staffOrderSprite++;
+                            GfxDrawSprite(dpi, ImageId(staffOrderSprite), { staffOrderIcon_x, y });
                         }
-                    }
-                    else
-                    {
-                        GfxDrawSprite(dpi, GetCostumeInlineSprite(peep->AnimationObjectIndex), { staffOrderIcon_x, y });
+                        staffOrders = staffOrders >> 1;
+                        staffOrderIcon_x += 9;
+                        // TODO: Remove sprite ID addition
+                        staffOrderSprite++;
                     }
                 }
-
-                y += kScrollableRowHeight;
-                i++;
+                else
+                {
+                    GfxDrawSprite(dpi, GetCostumeInlineSprite(peep->AnimationObjectIndex), { staffOrderIcon_x, y });
+                }
             }
         }
 
@@ -120,6 +120,8 @@ namespace OpenRCT2::Ui::Windows
     WindowBase* GuestListOpen();
     WindowBase* GuestListOpenWithFilter(GuestListFilterType type, int32_t index);
     void WindowGuestListRefreshList();
+    void WindowGuestListInvalidateNames();
+    void WindowGuestListRemoveName(EntityId guestId);
 
     // InstallTrack
     WindowBase* InstallTrackOpen(const utf8* path);
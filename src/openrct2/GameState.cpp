@@ -302,14 +302,21 @@ namespace OpenRCT2
         ClimateUpdate();
         MapUpdateTiles();
 
-        // Temporarily remove provisional paths to prevent peep from interacting with them
-        auto removeProvisionalIntent = Intent(INTENT_ACTION_REMOVE_PROVISIONAL_ELEMENTS);
-        ContextBroadcastIntent(&removeProvisionalIntent);
+        // Temporarily remove provisional paths to prevent peep from interacting with them.
+        // Provisional elements are only placed by construction windows, which a headless instance does not have.
+        if (!gOpenRCT2Headless)
+        {
+            auto removeProvisionalIntent = Intent(INTENT_ACTION_REMOVE_PROVISIONAL_ELEMENTS);
+            ContextBroadcastIntent(&removeProvisionalIntent);
+        }
 
         MapUpdatePathWideFlags();
         PeepUpdateAll();
-        auto restoreProvisionalIntent = Intent(INTENT_ACTION_RESTORE_PROVISIONAL_ELEMENTS);
-        ContextBroadcastIntent(&restoreProvisionalIntent);
+        if (!gOpenRCT2Headless)
+        {
+            auto restoreProvisionalIntent = Intent(INTENT_ACTION_RESTORE_PROVISIONAL_ELEMENTS);
+            ContextBroadcastIntent(&restoreProvisionalIntent);
+        }
         VehicleUpdateAll();
         UpdateAllMiscEntities();
         Ride::UpdateAll();
@@ -324,10 +331,14 @@ namespace OpenRCT2
         RideMeasurementsUpdate();
         News::UpdateCurrentItem();
 
+        // Not presentation only: animating doors and the clock tower update wall elements and guests.
         MapAnimationInvalidateAll();
-        VehicleSoundsUpdate();
-        PeepUpdateCrowdNoise();
-        ClimateUpdateSound();
+        if (!gOpenRCT2Headless)
+        {
+            VehicleSoundsUpdate();
+            PeepUpdateCrowdNoise();
+            ClimateUpdateSound();
+        }
         EditorOpenWindowsForCurrentStep();
 
         // Update windows
@@ -802,7 +802,7 @@ void CheatSetAction::OwnAllLand() const
             // only own tiles that were not set to 0
             if (destOwnership != OWNERSHIP_UNOWNED)
             {
-                surfaceElement->SetOwnership(destOwnership);
+                Park::SetTileOwnership(*surfaceElement, destOwnership);
                 Park::UpdateFencesAroundTile(coords);
                 MapInvalidateTile({ coords, baseZ, baseZ + 16 });
             }
@@ -815,7 +815,7 @@ void CheatSetAction::OwnAllLand() const
         auto* surfaceElement = MapGetSurfaceElementAt(spawn);
         if (surfaceElement != nullptr)
         {
-            surfaceElement->SetOwnership(OWNERSHIP_UNOWNED);
+            Park::SetTileOwnership(*surfaceElement, OWNERSHIP_UNOWNED);
             Park::UpdateFencesAroundTile(spawn);
             uint16_t baseZ = surfaceElement->GetBaseZ();
             MapInvalidateTile({ spawn, baseZ, baseZ + 16 });
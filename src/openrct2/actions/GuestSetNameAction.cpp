@@ -97,7 +97,7 @@ GameActions::Result GuestSetNameAction::Execute() const
 
     GfxInvalidateScreen();
 
-    auto intent = Intent(INTENT_ACTION_REFRESH_GUEST_LIST);
+    auto intent = Intent(INTENT_ACTION_INVALIDATE_GUEST_NAMES);
     ContextBroadcastIntent(&intent);
 
     auto res = GameActions::Result();
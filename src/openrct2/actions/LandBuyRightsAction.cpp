@@ -141,7 +141,7 @@ GameActions::Result LandBuyRightsAction::MapBuyLandRightsForTile(const CoordsXY&
             }
             if (isExecuting)
             {
-                surfaceElement->SetOwnership(OWNERSHIP_OWNED);
+                Park::SetTileOwnership(*surfaceElement, OWNERSHIP_OWNED);
                 Park::UpdateFencesAroundTile(loc);
             }
             res.Cost = GetGameState().LandPrice;
@@ -162,7 +162,7 @@ GameActions::Result LandBuyRightsAction::MapBuyLandRightsForTile(const CoordsXY&
 
             if (isExecuting)
             {
-                surfaceElement->SetOwnership(surfaceElement->GetOwnership() | OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED);
+                Park::SetTileOwnership(*surfaceElement, surfaceElement->GetOwnership() | OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED);
                 uint16_t baseZ = surfaceElement->GetBaseZ();
                 MapInvalidateTile({ loc, baseZ, baseZ + 16 });
             }
@@ -128,15 +128,15 @@ GameActions::Result LandSetRightsAction::MapBuyLandRightsForTile(const CoordsXY&
         case LandSetRightSetting::UnownLand:
             if (isExecuting)
             {
-                surfaceElement->SetOwnership(
-                    surfaceElement->GetOwnership() & ~(OWNERSHIP_OWNED | OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED));
+                Park::SetTileOwnership(
+                    *surfaceElement, surfaceElement->GetOwnership() & ~(OWNERSHIP_OWNED | OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED));
                 Park::UpdateFencesAroundTile(loc);
             }
             return res;
         case LandSetRightSetting::UnownConstructionRights:
             if (isExecuting)
             {
-                surfaceElement->SetOwnership(surfaceElement->GetOwnership() & ~OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED);
+                Park::SetTileOwnership(*surfaceElement, surfaceElement->GetOwnership() & ~OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED);
                 uint16_t baseZ = surfaceElement->GetBaseZ();
                 MapInvalidateTile({ loc, baseZ, baseZ + 16 });
             }
@@ -144,7 +144,7 @@ GameActions::Result LandSetRightsAction::MapBuyLandRightsForTile(const CoordsXY&
         case LandSetRightSetting::SetForSale:
             if (isExecuting)
             {
-                surfaceElement->SetOwnership(surfaceElement->GetOwnership() | OWNERSHIP_AVAILABLE);
+                Park::SetTileOwnership(*surfaceElement, surfaceElement->GetOwnership() | OWNERSHIP_AVAILABLE);
                 uint16_t baseZ = surfaceElement->GetBaseZ();
                 MapInvalidateTile({ loc, baseZ, baseZ + 16 });
             }
@@ -152,7 +152,8 @@ GameActions::Result LandSetRightsAction::MapBuyLandRightsForTile(const CoordsXY&
         case LandSetRightSetting::SetConstructionRightsForSale:
             if (isExecuting)
             {
-                surfaceElement->SetOwnership(surfaceElement->GetOwnership() | OWNERSHIP_CONSTRUCTION_RIGHTS_AVAILABLE);
+                Park::SetTileOwnership(
+                    *surfaceElement, surfaceElement->GetOwnership() | OWNERSHIP_CONSTRUCTION_RIGHTS_AVAILABLE);
                 uint16_t baseZ = surfaceElement->GetBaseZ();
                 MapInvalidateTile({ loc, baseZ, baseZ + 16 });
             }
@@ -224,7 +225,7 @@ GameActions::Result LandSetRightsAction::MapBuyLandRightsForTile(const CoordsXY&
                             }),
                         gameState.PeepSpawns.end());
                 }
-                surfaceElement->SetOwnership(_ownership);
+                Park::SetTileOwnership(*surfaceElement, _ownership);
                 Park::UpdateFencesAroundTile(loc);
                 gMapLandRightsUpdateSuccess = true;
             }
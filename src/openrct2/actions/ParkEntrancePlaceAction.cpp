@@ -149,7 +149,7 @@ GameActions::Result ParkEntrancePlaceAction::Execute() const
             SurfaceElement* surfaceElement = MapGetSurfaceElementAt(entranceLoc);
             if (surfaceElement != nullptr)
             {
-                surfaceElement->SetOwnership(OWNERSHIP_UNOWNED);
+                Park::SetTileOwnership(*surfaceElement, OWNERSHIP_UNOWNED);
             }
         }
 
@@ -0,0 +1,47 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2025 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../interface/Screenshot.h"
+#include "CommandLine.hpp"
+
+using namespace OpenRCT2;
+
+static BenchGfxOptions _options;
+
+// clang-format off
+static constexpr CommandLineOptionDefinition kBenchGfxOptionsDef[]
+{
+    { CMDLINE_TYPE_INTEGER, &_options.Iterations,  kNAC, "iterations",    "number of timed frames per view (default 10)"      },
+    { CMDLINE_TYPE_SWITCH,  &_options.Hash,        kNAC, "hash",          "print a hash of each rendered view"                },
+    { CMDLINE_TYPE_SWITCH,  &_options.Present,     kNAC, "present",       "time converting each view for the display"         },
+    { CMDLINE_TYPE_SWITCH,  &_options.NoTileCache, kNAC, "no-tile-cache", "paint every tile instead of replaying cached ones" },
+    kOptionTableEnd
+};
+
+static exitcode_t HandleBenchGfx(CommandLineArgEnumerator *argEnumerator);
+
+const CommandLineCommand CommandLine::kBenchGfxCommands[]
+{
+    // Main commands
+    DefineCommand("", "<file> [<width> <height>]", kBenchGfxOptionsDef, HandleBenchGfx),
+    kCommandTableEnd
+};
+// clang-format on
+
+static exitcode_t HandleBenchGfx(CommandLineArgEnumerator* argEnumerator)
+{
+    const char** argv = const_cast<const char**>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+    int32_t result = CommandLineForBenchGfx(argv, argc, &_options);
+    if (result < 0)
+    {
+        return EXITCODE_FAIL;
+    }
+    return EXITCODE_OK;
+}
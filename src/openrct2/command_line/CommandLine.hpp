@@ -112,6 +112,7 @@ namespace OpenRCT2::CommandLine
     extern const CommandLineCommand kSpriteCommands[];
     extern const CommandLineCommand kSimulateCommands[];
     extern const CommandLineCommand kParkInfoCommands[];
+    extern const CommandLineCommand kBenchGfxCommands[];
 
     extern const CommandLineExample kRootExamples[];
 
@@ -146,6 +146,7 @@ const CommandLineCommand CommandLine::kRootCommands[]
     DefineSubCommand("sprite",          CommandLine::kSpriteCommands           ),
     DefineSubCommand("simulate",        CommandLine::kSimulateCommands         ),
     DefineSubCommand("parkinfo",        CommandLine::kParkInfoCommands         ),
+    DefineSubCommand("benchgfx",        CommandLine::kBenchGfxCommands         ),
     kCommandTableEnd
 };
 
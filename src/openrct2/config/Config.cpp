@@ -603,7 +603,9 @@ namespace OpenRCT2::Config
         {
             auto model = &_config.plugin;
             model->EnableHotReloading = reader->GetBoolean("enable_hot_reloading", false);
+            model->EnableBytecodeCache = reader->GetBoolean("enable_bytecode_cache", false);
             model->AllowedHosts = reader->GetString("allowed_hosts", "");
+            model->TimeBudget = reader->GetInt32("time_budget", 0);
         }
     }
 
@@ -612,7 +614,9 @@ namespace OpenRCT2::Config
         auto model = &_config.plugin;
         writer->WriteSection("plugin");
         writer->WriteBoolean("enable_hot_reloading", model->EnableHotReloading);
+        writer->WriteBoolean("enable_bytecode_cache", model->EnableBytecodeCache);
         writer->WriteString("allowed_hosts", model->AllowedHosts);
+        writer->WriteInt32("time_budget", model->TimeBudget);
     }
 
     bool SetDefaults()
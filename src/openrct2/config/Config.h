@@ -226,7 +226,9 @@ namespace OpenRCT2::Config
     struct Plugin
     {
         bool EnableHotReloading;
+        bool EnableBytecodeCache;
         u8string AllowedHosts;
+        int32_t TimeBudget;
     };
 
     struct Config
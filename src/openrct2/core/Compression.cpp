@@ -126,7 +126,7 @@ namespace OpenRCT2::Compression
         return output;
     }
 
-    std::vector<uint8_t> ungzip(const void* data, const size_t dataLen)
+    std::vector<uint8_t> ungzip(const void* data, const size_t dataLen, const size_t maxOutputSize)
     {
         assert(data != nullptr);
 
@@ -161,11 +161,17 @@ namespace OpenRCT2::Compression
                 strm.avail_out = static_cast<uInt>(nextBlockSize);
                 strm.next_out = &output[output.size() - nextBlockSize];
                 const auto ret = inflate(&strm, flush);
-                if (ret == Z_STREAM_ERROR)
+                if (ret == Z_STREAM_ERROR || ret == Z_DATA_ERROR || ret == Z_MEM_ERROR || ret == Z_NEED_DICT)
                 {
-                    throw std::runtime_error("deflate failed with error " + std::to_string(ret));
+                    inflateEnd(&strm);
+                    throw std::runtime_error("inflate failed with error " + std::to_string(ret));
                 }
                 output.resize(output.size() - strm.avail_out);
+                if (output.size() > maxOutputSize)
+                {
+                    inflateEnd(&strm);
+                    throw std::runtime_error("inflated data is larger than " + std::to_string(maxOutputSize) + " bytes");
+                }
             } while (strm.avail_out == 0);
 
             src += nextBlockSize;
@@ -17,5 +17,6 @@ namespace OpenRCT2::Compression
 {
     bool gzipCompress(FILE* source, FILE* dest);
     std::vector<uint8_t> gzip(const void* data, const size_t dataLen);
-    std::vector<uint8_t> ungzip(const void* data, const size_t dataLen);
+    // Throws std::runtime_error if the data is invalid or inflates to more than maxOutputSize bytes.
+    std::vector<uint8_t> ungzip(const void* data, const size_t dataLen, const size_t maxOutputSize = SIZE_MAX);
 } // namespace OpenRCT2::Compression
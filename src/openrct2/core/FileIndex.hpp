@@ -17,13 +17,18 @@
 #include "FileScanner.h"
 #include "FileStream.h"
 #include "JobPool.h"
+#include "MemoryStream.h"
 #include "Numerics.hpp"
 #include "Path.hpp"
 
+#include <algorithm>
 #include <chrono>
+#include <iterator>
 #include <list>
+#include <optional>
 #include <string>
-#include <tuple>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 template<typename TItem>
@@ -38,18 +43,37 @@ private:
         uint32_t PathChecksum = 0;
     };
 
+    // The version of a file that an index item was created from.
+    struct FileRecord
+    {
+        uint64_t Size = 0;
+        uint64_t LastModified = 0;
+
+        bool operator==(const FileRecord&) const = default;
+    };
+
     struct ScanResult
     {
         DirectoryStats const Stats;
         std::vector<std::string> const Files;
+        std::vector<FileRecord> const Records;
 
-        ScanResult(DirectoryStats stats, std::vector<std::string>&& files) noexcept
+        ScanResult(DirectoryStats stats, std::vector<std::string>&& files, std::vector<FileRecord>&& records) noexcept
             : Stats(stats)
             , Files(std::move(files))
+            , Records(std::move(records))
         {
         }
     };
 
+    // A file from an out of date index, and the item that was created from it if any.
+    struct IndexedFile
+    {
+        FileRecord Record;
+        std::optional<TItem> Item;
+    };
+    using IndexedFiles = std::unordered_map<std::string, IndexedFile>;
+
     struct FileIndexHeader
     {
         uint32_t HeaderSize = sizeof(FileIndexHeader);
@@ -59,10 +83,11 @@ private:
         uint16_t LanguageId = 0;
         DirectoryStats Stats;
         uint32_t NumItems = 0;
+        uint32_t NumFiles = 0;
     };
 
     // Index file format version which when incremented forces a rebuild
-    static constexpr uint8_t kFileIndexVersion = 4;
+    static constexpr uint8_t kFileIndexVersion = 5;
 
     std::string const _name;
     uint32_t const _magicNumber;
@@ -99,24 +124,22 @@ public:
 
     /**
      * Queries and directories and loads the index header. If the index is up to date,
-     * the items are loaded from the index and returned, otherwise the index is rebuilt.
+     * the items are loaded from the index and returned, otherwise the index is updated
+     * by creating items only for the files that were added or changed.
      */
     std::vector<TItem> LoadOrBuild(int32_t language) const
     {
         std::vector<TItem> items;
+        IndexedFiles indexedFiles;
         auto scanResult = Scan();
-        auto readIndexResult = ReadIndexFile(language, scanResult.Stats);
-        if (std::get<0>(readIndexResult))
+        if (ReadIndexFile(language, scanResult.Stats, items, indexedFiles))
         {
             // Index was loaded
-            items = std::get<1>(readIndexResult);
-        }
-        else
-        {
-            // Index was not loaded
-            items = Build(language, scanResult);
+            return items;
         }
-        return items;
+
+        // Index was not loaded or is out of date
+        return Build(language, scanResult, std::move(indexedFiles));
     }
 
     std::vector<TItem> Rebuild(int32_t language) const
@@ -142,6 +165,7 @@ private:
     {
         DirectoryStats stats{};
         std::vector<std::string> files;
+        std::vector<FileRecord> records;
         for (const auto& directory : SearchPaths)
         {
             auto absoluteDirectory = OpenRCT2::Path::GetAbsolute(directory);
@@ -162,46 +186,88 @@ private:
                 stats.PathChecksum += GetPathChecksum(path);
 
                 files.push_back(std::move(path));
+                records.push_back({ fileInfo.Size, fileInfo.LastModified });
             }
         }
-        return ScanResult(stats, std::move(files));
+        return ScanResult(stats, std::move(files), std::move(records));
     }
 
-    std::vector<TItem> Build(int32_t language, const ScanResult& scanResult) const
+    std::vector<TItem> Build(int32_t language, const ScanResult& scanResult, IndexedFiles&& indexedFiles = {}) const
     {
-        std::vector<TItem> allItems;
-        OpenRCT2::Console::WriteLine("Building %s (%zu items)", _name.c_str(), scanResult.Files.size());
+        const size_t totalCount = scanResult.Files.size();
+
+        // Reuse the items of files that have not changed since the index was written.
+        std::vector<std::optional<TItem>> fileItems(totalCount);
+        std::vector<size_t> filesToCreate;
+        for (size_t i = 0; i < totalCount; i++)
+        {
+            auto it = indexedFiles.find(scanResult.Files[i]);
+            if (it != indexedFiles.end() && it->second.Record == scanResult.Records[i])
+            {
+                fileItems[i] = std::move(it->second.Item);
+            }
+            else
+            {
+                filesToCreate.push_back(i);
+            }
+        }
+        indexedFiles.clear();
+
+        if (filesToCreate.size() == totalCount)
+        {
+            OpenRCT2::Console::WriteLine("Building %s (%zu items)", _name.c_str(), totalCount);
+        }
+        else
+        {
+            OpenRCT2::Console::WriteLine(
+                "Updating %s (%zu of %zu items changed)", _name.c_str(), filesToCreate.size(), totalCount);
+        }
 
         auto startTime = std::chrono::high_resolution_clock::now();
 
-        const size_t totalCount = scanResult.Files.size();
-        if (totalCount > 0)
+        const size_t createCount = filesToCreate.size();
+        if (createCount > 0)
         {
             JobPool jobPool;
-            std::mutex mtx;
             std::atomic<size_t> processed{ 0 };
 
-            for (size_t i = 0; i < totalCount; i++)
+            // Each task creates the items for a contiguous range of files. Every file has its own slot, so no
+            // locking is needed. Using a few tasks per thread rather than one per file keeps the pool overhead
+            // low while still balancing the load.
+            const size_t numThreads = std::max(1u, std::thread::hardware_concurrency());
+            const size_t numTasks = std::min(createCount, numThreads * 8);
+            for (size_t task = 0; task < numTasks; task++)
             {
-                jobPool.AddTask([&, index = i]() {
-                    const auto& filePath = scanResult.Files.at(index);
-
-                    if (auto item = Create(language, filePath); item.has_value())
+                jobPool.AddTask([&, task]() {
+                    const auto begin = createCount * task / numTasks;
+                    const auto end = createCount * (task + 1) / numTasks;
+                    for (size_t i = begin; i < end; i++)
                     {
-                        std::lock_guard lock(mtx);
-                        allItems.push_back(std::move(item.value()));
+                        const auto index = filesToCreate[i];
+                        fileItems[index] = Create(language, scanResult.Files[index]);
+                        processed++;
                     }
-
-                    processed++;
                 });
             }
 
             jobPool.Join([&]() {
-                OpenRCT2::GetContext()->SetProgress(static_cast<uint32_t>(processed.load()), static_cast<uint32_t>(totalCount));
+                OpenRCT2::GetContext()->SetProgress(
+                    static_cast<uint32_t>(processed.load()), static_cast<uint32_t>(createCount));
             });
         }
 
-        WriteIndexFile(language, scanResult.Stats, allItems);
+        WriteIndexFile(language, scanResult, fileItems);
+
+        // Items are returned in the order the files were scanned.
+        std::vector<TItem> allItems;
+        allItems.reserve(totalCount);
+        for (auto& item : fileItems)
+        {
+            if (item.has_value())
+            {
+                allItems.push_back(std::move(item.value()));
+            }
+        }
 
         auto endTime = std::chrono::high_resolution_clock::now();
         auto duration = std::chrono::duration<float>(endTime - startTime);
@@ -210,57 +276,94 @@ private:
         return allItems;
     }
 
-    std::tuple<bool, std::vector<TItem>> ReadIndexFile(int32_t language, const DirectoryStats& stats) const
+    /**
+     * Reads the index file. Returns true with all the items if the directories have not changed since the index was
+     * written. Otherwise returns false, with the files and items of a compatible index in indexedFiles.
+     */
+    bool ReadIndexFile(
+        int32_t language, const DirectoryStats& stats, std::vector<TItem>& items, IndexedFiles& indexedFiles) const
     {
-        bool loadedItems = false;
-        std::vector<TItem> items;
-        if (OpenRCT2::File::Exists(_indexPath))
+        if (!OpenRCT2::File::Exists(_indexPath))
+        {
+            return false;
+        }
+
+        try
         {
-            try
+            LOG_VERBOSE("FileIndex:Loading index: '%s'", _indexPath.c_str());
+            auto fs = OpenRCT2::FileStream(_indexPath, OpenRCT2::FILE_MODE_OPEN);
+
+            // Read header, check if the items can be used
+            auto header = fs.ReadValue<FileIndexHeader>();
+            if (header.HeaderSize != sizeof(FileIndexHeader) || header.MagicNumber != _magicNumber
+                || header.VersionA != kFileIndexVersion || header.VersionB != _version || header.LanguageId != language)
             {
-                LOG_VERBOSE("FileIndex:Loading index: '%s'", _indexPath.c_str());
-                auto fs = OpenRCT2::FileStream(_indexPath, OpenRCT2::FILE_MODE_OPEN);
-
-                // Read header, check if we need to re-scan
-                auto header = fs.ReadValue<FileIndexHeader>();
-                if (header.HeaderSize == sizeof(FileIndexHeader) && header.MagicNumber == _magicNumber
-                    && header.VersionA == kFileIndexVersion && header.VersionB == _version && header.LanguageId == language
-                    && header.Stats.TotalFiles == stats.TotalFiles && header.Stats.TotalFileSize == stats.TotalFileSize
-                    && header.Stats.FileDateModifiedChecksum == stats.FileDateModifiedChecksum
-                    && header.Stats.PathChecksum == stats.PathChecksum)
-                {
-                    items.reserve(header.NumItems);
-                    DataSerialiser ds(false, fs);
-                    // Directory is the same, just read the saved items
-                    for (uint32_t i = 0; i < header.NumItems; i++)
-                    {
-                        TItem item;
-                        Serialise(ds, item);
-                        items.emplace_back(std::move(item));
-                    }
-                    loadedItems = true;
-                }
-                else
-                {
-                    OpenRCT2::Console::WriteLine("%s out of date", _name.c_str());
-                }
+                OpenRCT2::Console::WriteLine("%s out of date", _name.c_str());
+                return false;
             }
-            catch (const std::exception& e)
+
+            // Read the rest of the index in one go, deserialising from memory avoids a file stream call
+            // for every field.
+            std::vector<uint8_t> data(fs.GetLength() - fs.GetPosition());
+            fs.Read(data.data(), data.size());
+            OpenRCT2::MemoryStream ms(data.data(), data.size());
+            DataSerialiser ds(false, ms);
+
+            items.reserve(header.NumItems);
+            for (uint32_t i = 0; i < header.NumItems; i++)
             {
-                OpenRCT2::Console::Error::WriteLine("Unable to load index: '%s'.", _indexPath.c_str());
-                OpenRCT2::Console::Error::WriteLine("%s", e.what());
+                TItem item;
+                Serialise(ds, item);
+                items.emplace_back(std::move(item));
+            }
+
+            if (header.Stats.TotalFiles == stats.TotalFiles && header.Stats.TotalFileSize == stats.TotalFileSize
+                && header.Stats.FileDateModifiedChecksum == stats.FileDateModifiedChecksum
+                && header.Stats.PathChecksum == stats.PathChecksum)
+            {
+                // Directory is the same, just use the saved items
+                return true;
+            }
+
+            // Some files have changed, match the saved items up with the files they were created from.
+            OpenRCT2::Console::WriteLine("%s out of date", _name.c_str());
+            size_t itemIndex = 0;
+            for (uint32_t i = 0; i < header.NumFiles; i++)
+            {
+                std::string path;
+                IndexedFile indexedFile;
+                bool hasItem{};
+                ds << path;
+                ds << indexedFile.Record.Size;
+                ds << indexedFile.Record.LastModified;
+                ds << hasItem;
+                if (hasItem && itemIndex < items.size())
+                {
+                    indexedFile.Item = std::move(items[itemIndex++]);
+                }
+                indexedFiles.emplace(std::move(path), std::move(indexedFile));
             }
         }
-        return std::make_tuple(loadedItems, std::move(items));
+        catch (const std::exception& e)
+        {
+            OpenRCT2::Console::Error::WriteLine("Unable to load index: '%s'.", _indexPath.c_str());
+            OpenRCT2::Console::Error::WriteLine("%s", e.what());
+            indexedFiles.clear();
+        }
+        items.clear();
+        return false;
     }
 
-    void WriteIndexFile(int32_t language, const DirectoryStats& stats, const std::vector<TItem>& items) const
+    void WriteIndexFile(
+        int32_t language, const ScanResult& scanResult, const std::vector<std::optional<TItem>>& fileItems) const
     {
         try
         {
             LOG_VERBOSE("FileIndex:Writing index: '%s'", _indexPath.c_str());
             OpenRCT2::Path::CreateDirectory(OpenRCT2::Path::GetDirectory(_indexPath));
-            auto fs = OpenRCT2::FileStream(_indexPath, OpenRCT2::FILE_MODE_WRITE);
+
+            // Serialise to memory first and write the file in one go.
+            OpenRCT2::MemoryStream ms;
 
             // Write header
             FileIndexHeader header;
@@ -268,16 +371,37 @@ private:
             header.VersionA = kFileIndexVersion;
             header.VersionB = _version;
             header.LanguageId = language;
-            header.Stats = stats;
-            header.NumItems = static_cast<uint32_t>(items.size());
-            fs.WriteValue(header);
+            header.Stats = scanResult.Stats;
+            header.NumItems = static_cast<uint32_t>(
+                std::count_if(fileItems.begin(), fileItems.end(), [](const auto& item) { return item.has_value(); }));
+            header.NumFiles = static_cast<uint32_t>(scanResult.Files.size());
+            ms.WriteValue(header);
 
-            DataSerialiser ds(true, fs);
+            DataSerialiser ds(true, ms);
             // Write items
-            for (const auto& item : items)
+            for (const auto& item : fileItems)
             {
-                Serialise(ds, item);
+                if (item.has_value())
+                {
+                    Serialise(ds, item.value());
+                }
             }
+
+            // Write the files the items were created from, so that only changed files need to be read when the
+            // directories change.
+            for (size_t i = 0; i < scanResult.Files.size(); i++)
+            {
+                auto path = scanResult.Files[i];
+                auto record = scanResult.Records[i];
+                bool hasItem = fileItems[i].has_value();
+                ds << path;
+                ds << record.Size;
+                ds << record.LastModified;
+                ds << hasItem;
+            }
+
+            auto fs = OpenRCT2::FileStream(_indexPath, OpenRCT2::FILE_MODE_WRITE);
+            fs.Write(ms.GetData(), ms.GetLength());
         }
         catch (const std::exception& e)
         {
@@ -170,7 +170,7 @@ namespace OpenRCT2::Imaging
         }
     }
 
-    static void WritePng(std::ostream& ostream, const Image& image)
+    static void WritePng(std::ostream& ostream, const Image& image, const ImageRowFunc& getRow)
     {
         png_structp png_ptr = nullptr;
         png_colorp png_palette = nullptr;
@@ -239,11 +239,9 @@ namespace OpenRCT2::Imaging
             png_write_info(png_ptr, info_ptr);
 
             // Write pixels
-            auto pixels = image.Pixels.data();
             for (uint32_t y = 0; y < image.Height; y++)
             {
-                png_write_row(png_ptr, const_cast<png_byte*>(pixels));
-                pixels += image.Stride;
+                png_write_row(png_ptr, const_cast<png_byte*>(getRow(y)));
             }
 
             png_write_end(png_ptr, nullptr);
@@ -332,20 +330,25 @@ namespace OpenRCT2::Imaging
     }
 
     void WriteToFile(std::string_view path, const Image& image, IMAGE_FORMAT format)
+    {
+        WriteToFile(path, image, [&image](uint32_t y) { return image.Pixels.data() + (y * image.Stride); }, format);
+    }
+
+    void WriteToFile(std::string_view path, const Image& image, const ImageRowFunc& getRow, IMAGE_FORMAT format)
     {
         switch (format)
         {
             case IMAGE_FORMAT::AUTOMATIC:
-                WriteToFile(path, image, GetImageFormatFromPath(path));
+                WriteToFile(path, image, getRow, GetImageFormatFromPath(path));
                 break;
             case IMAGE_FORMAT::PNG:
             {
 #ifndef __EMSCRIPTEN__
                 std::ofstream fs(fs::u8path(path), std::ios::binary);
-                WritePng(fs, image);
+                WritePng(fs, image, getRow);
 #else
                 std::ostringstream stream(std::ios::binary);
-                WritePng(stream, image);
+                WritePng(stream, image, getRow);
                 std::string dataStr = stream.str();
                 void* data = reinterpret_cast<void*>(dataStr.data());
                 MAIN_THREAD_EM_ASM(
@@ -44,6 +44,9 @@ struct Image
 
 using ImageReaderFunc = std::function<Image(std::istream&, IMAGE_FORMAT)>;
 
+// Returns the pixels of the given row. Rows are requested in order from the top, so they can be produced on demand.
+using ImageRowFunc = std::function<const uint8_t*(uint32_t y)>;
+
 namespace OpenRCT2::Imaging
 {
     IMAGE_FORMAT GetImageFormatFromPath(std::string_view path);
@@ -51,5 +54,11 @@ namespace OpenRCT2::Imaging
     Image ReadFromBuffer(const std::vector<uint8_t>& buffer, IMAGE_FORMAT format = IMAGE_FORMAT::AUTOMATIC);
     void WriteToFile(std::string_view path, const Image& image, IMAGE_FORMAT format = IMAGE_FORMAT::AUTOMATIC);
 
+    /**
+     * Writes an image whose pixels are not held in image.Pixels but provided a row at a time by getRow.
+     */
+    void WriteToFile(
+        std::string_view path, const Image& image, const ImageRowFunc& getRow, IMAGE_FORMAT format = IMAGE_FORMAT::AUTOMATIC);
+
     void SetReader(IMAGE_FORMAT format, ImageReaderFunc impl);
 } // namespace OpenRCT2::Imaging
@@ -41,6 +41,99 @@ void MaskAvx2(
     }
 }
 
+void PaletteLookupAvx2(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint32_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap,
+    const uint32_t* RESTRICT palette)
+{
+    const auto* paletteInts = reinterpret_cast<const int*>(palette);
+    for (int32_t yy = 0; yy < height; yy++)
+    {
+        int32_t xx = 0;
+        for (; xx + 8 <= width; xx += 8)
+        {
+            const __m128i indices8 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + xx));
+            const __m256i indices = _mm256_cvtepu8_epi32(indices8);
+            const __m256i colours = _mm256_i32gather_epi32(paletteInts, indices, 4);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + xx), colours);
+        }
+        for (; xx < width; xx++)
+        {
+            dst[xx] = palette[src[xx]];
+        }
+        src += width + srcWrap;
+        dst += width + dstWrap;
+    }
+}
+
+void LightAccumulateAvx2(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap,
+    uint8_t intensity)
+{
+    const int32_t vectorWidth = width & ~31;
+    // The product of a light value and (intensity + 1) always fits in 16 bits.
+    const __m256i scale = _mm256_set1_epi16(static_cast<int16_t>(intensity + 1));
+    const __m256i zero = {};
+    for (int32_t yy = 0; yy < height; yy++)
+    {
+        for (int32_t xx = 0; xx < vectorWidth; xx += 32)
+        {
+            const __m256i light = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + xx));
+            const __m256i lo = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(light, zero), scale), 8);
+            const __m256i hi = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(light, zero), scale), 8);
+            const __m256i dest = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + xx));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + xx), _mm256_adds_epu8(dest, _mm256_packus_epi16(lo, hi)));
+        }
+        LightAccumulateScalar(width - vectorWidth, 1, src + vectorWidth, dst + vectorWidth, 0, 0, intensity);
+        src += width + srcWrap;
+        dst += width + dstWrap;
+    }
+}
+
+void LightBlendAvx2(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, const uint8_t* RESTRICT light, uint32_t* RESTRICT dst,
+    int32_t srcWrap, int32_t lightWrap, int32_t dstWrap, const uint32_t* RESTRICT palette,
+    const uint32_t* RESTRICT lightPalette)
+{
+    const auto* paletteInts = reinterpret_cast<const int*>(palette);
+    const auto* lightPaletteInts = reinterpret_cast<const int*>(lightPalette);
+    const int32_t vectorWidth = width & ~7;
+    const __m256i zero = {};
+    for (int32_t yy = 0; yy < height; yy++)
+    {
+        for (int32_t xx = 0; xx < vectorWidth; xx += 8)
+        {
+            const __m256i indices = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + xx)));
+            const __m256i dark = _mm256_i32gather_epi32(paletteInts, indices, 4);
+
+            const __m128i intensities = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(light + xx));
+            if (_mm_testz_si128(intensities, intensities))
+            {
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + xx), dark);
+                continue;
+            }
+            const __m256i lit = _mm256_i32gather_epi32(lightPaletteInts, indices, 4);
+
+            // Same as the SSE4.1 version, the unpacks and pack work per 128-bit lane so the pixel order is kept.
+            const __m256i intensity = _mm256_cvtepu8_epi32(intensities);
+            const __m256i scale = _mm256_add_epi32(_mm256_slli_epi32(intensity, 1), _mm256_slli_epi32(intensity, 2));
+            const __m256i scalePairs = _mm256_or_si256(scale, _mm256_slli_epi32(scale, 16));
+            const __m256i scaleLo = _mm256_unpacklo_epi32(scalePairs, scalePairs);
+            const __m256i scaleHi = _mm256_unpackhi_epi32(scalePairs, scalePairs);
+
+            const __m256i addLo = _mm256_mulhi_epu16(_mm256_slli_epi16(_mm256_unpacklo_epi8(lit, zero), 8), scaleLo);
+            const __m256i addHi = _mm256_mulhi_epu16(_mm256_slli_epi16(_mm256_unpackhi_epi8(lit, zero), 8), scaleHi);
+            const __m256i lo = _mm256_add_epi16(_mm256_unpacklo_epi8(dark, zero), addLo);
+            const __m256i hi = _mm256_add_epi16(_mm256_unpackhi_epi8(dark, zero), addHi);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + xx), _mm256_packus_epi16(lo, hi));
+        }
+        LightBlendScalar(
+            width - vectorWidth, 1, src + vectorWidth, light + vectorWidth, dst + vectorWidth, 0, 0, 0, palette, lightPalette);
+        src += width + srcWrap;
+        light += width + lightWrap;
+        dst += width + dstWrap;
+    }
+}
+
 #else
 
     #ifdef OPENRCT2_X86
@@ -54,4 +147,26 @@ void MaskAvx2(
     OpenRCT2::Guard::Fail("AVX2 function called on a CPU that doesn't support AVX2");
 }
 
+void PaletteLookupAvx2(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint32_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap,
+    const uint32_t* RESTRICT palette)
+{
+    OpenRCT2::Guard::Fail("AVX2 function called on a CPU that doesn't support AVX2");
+}
+
+void LightAccumulateAvx2(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap,
+    uint8_t intensity)
+{
+    OpenRCT2::Guard::Fail("AVX2 function called on a CPU that doesn't support AVX2");
+}
+
+void LightBlendAvx2(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, const uint8_t* RESTRICT light, uint32_t* RESTRICT dst,
+    int32_t srcWrap, int32_t lightWrap, int32_t dstWrap, const uint32_t* RESTRICT palette,
+    const uint32_t* RESTRICT lightPalette)
+{
+    OpenRCT2::Guard::Fail("AVX2 function called on a CPU that doesn't support AVX2");
+}
+
 #endif // __AVX2__
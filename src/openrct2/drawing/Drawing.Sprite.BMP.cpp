@@ -9,7 +9,9 @@
 
 #include "Drawing.h"
 
-template<DrawBlendOp TBlendOp>
+#include <array>
+
+template<DrawBlendOp TBlendOp, size_t TZoom>
 static void FASTCALL DrawBMPSpriteMagnify(DrawPixelInfo& dpi, const DrawSpriteArgs& args)
 {
     auto& paletteMap = args.PalMap;
@@ -19,23 +21,22 @@ static void FASTCALL DrawBMPSpriteMagnify(DrawPixelInfo& dpi, const DrawSpriteAr
     auto srcY = args.SrcY;
     auto width = args.Width;
     auto height = args.Height;
-    auto zoom = dpi.zoom_level;
     auto dstLineWidth = dpi.LineStride();
     auto srcLineWidth = args.SourceImage.width;
 
     for (int32_t y = 0; y < height; y++)
     {
         auto nextDst = dst + dstLineWidth;
+        auto srcLine = src0 + srcLineWidth * ((srcY + y) >> TZoom);
         for (int32_t x = 0; x < width; x++, dst++)
         {
-            auto src = src0 + (srcLineWidth * zoom.ApplyTo(srcY + y) + zoom.ApplyTo(srcX + x));
-            BlitPixel<TBlendOp>(src, dst, paletteMap);
+            BlitPixel<TBlendOp>(srcLine + ((srcX + x) >> TZoom), dst, paletteMap);
         }
         dst = nextDst;
     }
 }
 
-template<DrawBlendOp TBlendOp>
+template<DrawBlendOp TBlendOp, size_t TZoom>
 static void FASTCALL DrawBMPSpriteMinify(DrawPixelInfo& dpi, const DrawSpriteArgs& args)
 {
     auto& g1 = args.SourceImage;
@@ -44,10 +45,9 @@ static void FASTCALL DrawBMPSpriteMinify(DrawPixelInfo& dpi, const DrawSpriteArg
     auto& paletteMap = args.PalMap;
     auto width = args.Width;
     auto height = args.Height;
-    auto zoomLevel = dpi.zoom_level;
-    size_t srcLineWidth = zoomLevel.ApplyTo(g1.width);
+    constexpr int32_t zoom = 1 << TZoom;
+    size_t srcLineWidth = static_cast<size_t>(g1.width) << TZoom;
     size_t dstLineWidth = dpi.LineStride();
-    uint8_t zoom = zoomLevel.ApplyTo(1);
     for (; height > 0; height -= zoom)
     {
         auto nextSrc = src + srcLineWidth;
@@ -61,57 +61,62 @@ static void FASTCALL DrawBMPSpriteMinify(DrawPixelInfo& dpi, const DrawSpriteArg
     }
 }
 
+// Kernels for each zoom level, starting at kSpriteBlitterMinZoom.
 template<DrawBlendOp TBlendOp>
-static void FASTCALL DrawBMPSprite(DrawPixelInfo& dpi, const DrawSpriteArgs& args)
-{
-    if (dpi.zoom_level < ZoomLevel{ 0 })
-    {
-        DrawBMPSpriteMagnify<TBlendOp>(dpi, args);
-    }
-    else
-    {
-        DrawBMPSpriteMinify<TBlendOp>(dpi, args);
-    }
-}
+static constexpr std::array<SpriteBlitFunc, kSpriteBlitterZoomLevels> kBMPBlitters = {
+    DrawBMPSpriteMagnify<TBlendOp, 2>, DrawBMPSpriteMagnify<TBlendOp, 1>, DrawBMPSpriteMinify<TBlendOp, 0>,
+    DrawBMPSpriteMinify<TBlendOp, 1>,  DrawBMPSpriteMinify<TBlendOp, 2>,  DrawBMPSpriteMinify<TBlendOp, 3>,
+};
 
 /**
- * Copies a sprite onto the buffer. There is no compression used on the sprite
- * image.
+ * Returns the kernel that copies a bitmap sprite with the given image flags onto a buffer at the given zoom level.
+ * There is no compression used on the sprite image.
  *  rct2: 0x0067A690
- * @param imageId Only flags are used.
  */
-void FASTCALL GfxBmpSpriteToBuffer(DrawPixelInfo& dpi, const DrawSpriteArgs& args)
+SpriteBlitFunc GfxGetBmpSpriteBlitter(const ImageId image, const G1Element& g1, const ZoomLevel zoom)
 {
-    auto imageId = args.Image;
+    const auto zoomIndex = static_cast<size_t>(static_cast<int8_t>(zoom) - kSpriteBlitterMinZoom);
+    if (zoomIndex >= kSpriteBlitterZoomLevels)
+        return nullptr;
 
     // Image uses the palette pointer to remap the colours of the image
-    if (imageId.HasPrimary())
+    if (image.HasPrimary())
     {
-        if (imageId.IsBlended())
+        if (image.IsBlended())
         {
             // Copy non-transparent bitmap data but blend src and dst pixel using the palette map.
-            DrawBMPSprite<kBlendTransparent | kBlendSrc | kBlendDst>(dpi, args);
-        }
-        else
-        {
-            // Copy non-transparent bitmap data but re-colour using the palette map.
-            DrawBMPSprite<kBlendTransparent | kBlendSrc>(dpi, args);
+            return kBMPBlitters<kBlendTransparent | kBlendSrc | kBlendDst>[zoomIndex];
         }
+
+        // Copy non-transparent bitmap data but re-colour using the palette map.
+        return kBMPBlitters<kBlendTransparent | kBlendSrc>[zoomIndex];
     }
-    else if (imageId.IsBlended())
+    if (image.IsBlended())
     {
         // Image is only a transparency mask. Just colour the pixels using the palette map.
         // Used for glass.
-        DrawBMPSprite<kBlendTransparent | kBlendDst>(dpi, args);
+        return kBMPBlitters<kBlendTransparent | kBlendDst>[zoomIndex];
     }
-    else if (!(args.SourceImage.flags & G1_FLAG_HAS_TRANSPARENCY))
+    if (!(g1.flags & G1_FLAG_HAS_TRANSPARENCY))
     {
         // Copy raw bitmap data to target
-        DrawBMPSprite<kBlendNone>(dpi, args);
+        return kBMPBlitters<kBlendNone>[zoomIndex];
     }
-    else
+
+    // Copy raw bitmap data to target but exclude transparent pixels
+    return kBMPBlitters<kBlendTransparent>[zoomIndex];
+}
+
+/**
+ * Copies a sprite onto the buffer. There is no compression used on the sprite
+ * image.
+ * @param imageId Only flags are used.
+ */
+void FASTCALL GfxBmpSpriteToBuffer(DrawPixelInfo& dpi, const DrawSpriteArgs& args)
+{
+    auto blitter = GfxGetBmpSpriteBlitter(args.Image, args.SourceImage, dpi.zoom_level);
+    if (blitter != nullptr)
     {
-        // Copy raw bitmap data to target but exclude transparent pixels
-        DrawBMPSprite<kBlendTransparent>(dpi, args);
+        blitter(dpi, args);
     }
 }
@@ -9,10 +9,10 @@
 
 #include "Drawing.h"
 
-#include <cassert>
+#include <array>
 #include <cstring>
 
-template<DrawBlendOp TBlendOp>
+template<DrawBlendOp TBlendOp, size_t TZoom>
 static void FASTCALL DrawRLESpriteMagnify(DrawPixelInfo& dpi, const DrawSpriteArgs& args)
 {
     auto& paletteMap = args.PalMap;
@@ -22,13 +22,12 @@ static void FASTCALL DrawRLESpriteMagnify(DrawPixelInfo& dpi, const DrawSpriteAr
     auto srcY = args.SrcY;
     auto width = args.Width;
     auto height = args.Height;
-    auto zoom = dpi.zoom_level;
     auto dstLineWidth = dpi.LineStride();
 
     for (int32_t y = 0; y < height; y++)
     {
         uint8_t* nextDst = dst + dstLineWidth;
-        const int32_t rowNum = zoom.ApplyTo(srcY + y);
+        const int32_t rowNum = (srcY + y) >> TZoom;
         uint16_t lineOffset;
         std::memcpy(&lineOffset, &imgData[rowNum * sizeof(uint16_t)], sizeof(uint16_t));
         const uint8_t* data8 = imgData + lineOffset;
@@ -38,7 +37,7 @@ static void FASTCALL DrawRLESpriteMagnify(DrawPixelInfo& dpi, const DrawSpriteAr
         uint8_t pixelRunStart = 0;
         for (int32_t x = 0; x < width; x++)
         {
-            const int32_t colNum = zoom.ApplyTo(srcX + x);
+            const int32_t colNum = (srcX + x) >> TZoom;
 
             while (colNum >= pixelRunStart + numPixels && !lastDataForLine)
             {
@@ -152,59 +151,49 @@ static void FASTCALL DrawRLESpriteMinify(DrawPixelInfo& dpi, const DrawSpriteArg
     }
 }
 
+// Kernels for each zoom level, starting at kSpriteBlitterMinZoom.
 template<DrawBlendOp TBlendOp>
-static void FASTCALL DrawRLESprite(DrawPixelInfo& dpi, const DrawSpriteArgs& args)
+static constexpr std::array<SpriteBlitFunc, kSpriteBlitterZoomLevels> kRLEBlitters = {
+    DrawRLESpriteMagnify<TBlendOp, 2>, DrawRLESpriteMagnify<TBlendOp, 1>, DrawRLESpriteMinify<TBlendOp, 0>,
+    DrawRLESpriteMinify<TBlendOp, 1>,  DrawRLESpriteMinify<TBlendOp, 2>,  DrawRLESpriteMinify<TBlendOp, 3>,
+};
+
+/**
+ * Returns the kernel that transfers an RLE compressed sprite with the given image flags onto a buffer at the given zoom
+ * level.
+ *  rct2: 0x0067AA18
+ */
+SpriteBlitFunc GfxGetRleSpriteBlitter(const ImageId image, const ZoomLevel zoom)
 {
-    auto zoom_level = static_cast<int8_t>(dpi.zoom_level);
-    switch (zoom_level)
+    const auto zoomIndex = static_cast<size_t>(static_cast<int8_t>(zoom) - kSpriteBlitterMinZoom);
+    if (zoomIndex >= kSpriteBlitterZoomLevels)
+        return nullptr;
+
+    if (image.HasPrimary())
+    {
+        if (image.IsBlended())
+        {
+            return kRLEBlitters<kBlendTransparent | kBlendSrc | kBlendDst>[zoomIndex];
+        }
+        return kRLEBlitters<kBlendTransparent | kBlendSrc>[zoomIndex];
+    }
+    if (image.IsBlended())
     {
-        case -2:
-        case -1:
-            DrawRLESpriteMagnify<TBlendOp>(dpi, args);
-            break;
-        case 0:
-            DrawRLESpriteMinify<TBlendOp, 0>(dpi, args);
-            break;
-        case 1:
-            DrawRLESpriteMinify<TBlendOp, 1>(dpi, args);
-            break;
-        case 2:
-            DrawRLESpriteMinify<TBlendOp, 2>(dpi, args);
-            break;
-        case 3:
-            DrawRLESpriteMinify<TBlendOp, 3>(dpi, args);
-            break;
-        default:
-            assert(false);
-            break;
+        return kRLEBlitters<kBlendTransparent | kBlendDst>[zoomIndex];
     }
+    return kRLEBlitters<kBlendTransparent>[zoomIndex];
 }
 
 /**
  * Transfers readied images onto buffers
  * This function copies the sprite data onto the screen
- *  rct2: 0x0067AA18
  * @param imageId Only flags are used.
  */
 void FASTCALL GfxRleSpriteToBuffer(DrawPixelInfo& dpi, const DrawSpriteArgs& args)
 {
-    if (args.Image.HasPrimary())
-    {
-        if (args.Image.IsBlended())
-        {
-            DrawRLESprite<kBlendTransparent | kBlendSrc | kBlendDst>(dpi, args);
-        }
-        else
-        {
-            DrawRLESprite<kBlendTransparent | kBlendSrc>(dpi, args);
-        }
-    }
-    else if (args.Image.IsBlended())
-    {
-        DrawRLESprite<kBlendTransparent | kBlendDst>(dpi, args);
-    }
-    else
+    auto blitter = GfxGetRleSpriteBlitter(args.Image, dpi.zoom_level);
+    if (blitter != nullptr)
     {
-        DrawRLESprite<kBlendTransparent>(dpi, args);
+        blitter(dpi, args);
     }
 }
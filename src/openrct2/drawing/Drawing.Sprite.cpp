@@ -920,15 +920,25 @@ void FASTCALL GfxDrawSpritePaletteSetSoftware(
     GfxSpriteToBuffer(dpi, args);
 }
 
-void FASTCALL GfxSpriteToBuffer(DrawPixelInfo& dpi, const DrawSpriteArgs& args)
+SpriteBlitFunc GfxGetSpriteBlitter(const DrawSpriteArgs& args, ZoomLevel zoom)
 {
     if (args.SourceImage.flags & G1_FLAG_RLE_COMPRESSION)
     {
-        GfxRleSpriteToBuffer(dpi, args);
+        return GfxGetRleSpriteBlitter(args.Image, zoom);
+    }
+    if (!(args.SourceImage.flags & G1_FLAG_1))
+    {
+        return GfxGetBmpSpriteBlitter(args.Image, args.SourceImage, zoom);
     }
-    else if (!(args.SourceImage.flags & G1_FLAG_1))
+    return nullptr;
+}
+
+void FASTCALL GfxSpriteToBuffer(DrawPixelInfo& dpi, const DrawSpriteArgs& args)
+{
+    auto blitter = GfxGetSpriteBlitter(args, dpi.zoom_level);
+    if (blitter != nullptr)
     {
-        GfxBmpSpriteToBuffer(dpi, args);
+        blitter(dpi, args);
     }
 }
 
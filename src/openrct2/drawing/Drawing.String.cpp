@@ -10,6 +10,7 @@
 #include "../Context.h"
 #include "../config/Config.h"
 #include "../core/CodepointView.hpp"
+#include "../core/EnumUtils.hpp"
 #include "../core/String.hpp"
 #include "../core/UTF8.h"
 #include "../core/UnicodeChar.h"
@@ -23,10 +24,107 @@
 #include "../sprites.h"
 #include "TTF.h"
 
+#include <atomic>
+#include <unordered_map>
+
 using namespace OpenRCT2;
 
 static int32_t TTFGetStringWidth(std::string_view text, FontStyle fontStyle, bool noFormatting);
 
+// Window redraws measure and wrap the same strings many times per frame, so the results are cached per thread (text
+// is also measured while painting viewport columns). Bumping the generation drops every thread's cache.
+static std::atomic<uint32_t> _textLayoutGeneration;
+
+static constexpr size_t kMaxCachedStringWidths = 4096;
+static constexpr size_t kMaxCachedStringLayouts = 1024;
+
+struct TextLayoutKeyHash
+{
+    using is_transparent = void;
+
+    size_t operator()(std::string_view key) const
+    {
+        return std::hash<std::string_view>{}(key);
+    }
+};
+
+template<typename T>
+using TextLayoutMap = std::unordered_map<std::string, T, TextLayoutKeyHash, std::equal_to<>>;
+
+struct WrappedStringLayout
+{
+    u8string Text;
+    int32_t NumLines;
+    int32_t MaxWidth;
+};
+
+struct ClippedStringLayout
+{
+    u8string Text;
+    int32_t Width;
+};
+
+struct TextLayoutCache
+{
+    uint32_t Generation{};
+    TextLayoutMap<int32_t> Widths;
+    TextLayoutMap<WrappedStringLayout> Wrapped;
+    TextLayoutMap<ClippedStringLayout> Clipped;
+    std::string Key;
+};
+
+static TextLayoutCache& GetTextLayoutCache()
+{
+    thread_local TextLayoutCache cache;
+
+    const auto generation = _textLayoutGeneration.load(std::memory_order_relaxed);
+    if (cache.Generation != generation)
+    {
+        cache.Widths.clear();
+        cache.Wrapped.clear();
+        cache.Clipped.clear();
+        cache.Generation = generation;
+    }
+    return cache;
+}
+
+// The parameters are appended with a fixed size, so keys can never be ambiguous whatever the text contains.
+static std::string_view GetTextLayoutKey(TextLayoutCache& cache, std::string_view text, FontStyle fontStyle, int32_t param)
+{
+    cache.Key.assign(text);
+    cache.Key.push_back(static_cast<char>(EnumValue(fontStyle)));
+    cache.Key.append(reinterpret_cast<const char*>(&param), sizeof(param));
+    return cache.Key;
+}
+
+// The uncached measuring functions never use the cache themselves, so the key is still intact when adding the result.
+template<typename T>
+static T& AddTextLayout(TextLayoutMap<T>& map, size_t maxEntries, std::string_view key, T&& value)
+{
+    if (map.size() >= maxEntries)
+    {
+        map.clear();
+    }
+    return map.emplace(key, std::forward<T>(value)).first->second;
+}
+
+void GfxInvalidateTextLayoutCache()
+{
+    _textLayoutGeneration.fetch_add(1, std::memory_order_relaxed);
+}
+
+static int32_t GetStringWidthCached(std::string_view text, FontStyle fontStyle, bool noFormatting)
+{
+    auto& cache = GetTextLayoutCache();
+    const auto key = GetTextLayoutKey(cache, text, fontStyle, noFormatting ? 1 : 0);
+    if (auto it = cache.Widths.find(key); it != cache.Widths.end())
+    {
+        return it->second;
+    }
+
+    return AddTextLayout(cache.Widths, kMaxCachedStringWidths, key, TTFGetStringWidth(text, fontStyle, noFormatting));
+}
+
 /**
  *
  *  rct2: 0x006C23B1
@@ -68,12 +166,12 @@ int32_t GfxGetStringWidthNewLined(std::string_view text, FontStyle fontStyle)
  */
 int32_t GfxGetStringWidth(std::string_view text, FontStyle fontStyle)
 {
-    return TTFGetStringWidth(text, fontStyle, false);
+    return GetStringWidthCached(text, fontStyle, false);
 }
 
 int32_t GfxGetStringWidthNoFormatting(std::string_view text, FontStyle fontStyle)
 {
-    return TTFGetStringWidth(text, fontStyle, true);
+    return GetStringWidthCached(text, fontStyle, true);
 }
 
 /**
@@ -83,7 +181,7 @@ int32_t GfxGetStringWidthNoFormatting(std::string_view text, FontStyle fontStyle
  * buffer (esi)
  * width (edi)
  */
-int32_t GfxClipString(utf8* text, int32_t width, FontStyle fontStyle)
+static int32_t ClipStringUncached(utf8* text, int32_t width, FontStyle fontStyle)
 {
     if (width < 6)
     {
@@ -92,7 +190,7 @@ int32_t GfxClipString(utf8* text, int32_t width, FontStyle fontStyle)
     }
 
     // If width of the full string is less than allowed width then we don't need to clip
-    auto clippedWidth = GfxGetStringWidth(text, fontStyle);
+    auto clippedWidth = TTFGetStringWidth(text, fontStyle, false);
     if (clippedWidth <= width)
     {
         return clippedWidth;
@@ -114,7 +212,7 @@ int32_t GfxClipString(utf8* text, int32_t width, FontStyle fontStyle)
             // Add the ellipsis before checking the width
             buffer.append("...");
 
-            auto currentWidth = GfxGetStringWidth(buffer, fontStyle);
+            auto currentWidth = TTFGetStringWidth(buffer, fontStyle, false);
             if (currentWidth < width)
             {
                 bestLength = buffer.size();
@@ -142,7 +240,7 @@ int32_t GfxClipString(utf8* text, int32_t width, FontStyle fontStyle)
             buffer.append(cb);
         }
     }
-    return GfxGetStringWidth(text, fontStyle);
+    return TTFGetStringWidth(text, fontStyle, false);
 }
 
 /**
@@ -158,7 +256,8 @@ int32_t GfxClipString(utf8* text, int32_t width, FontStyle fontStyle)
  * num_lines (edi) - out
  * font_height (ebx) - out
  */
-int32_t GfxWrapString(u8string_view text, int32_t width, FontStyle fontStyle, u8string* outWrappedText, int32_t* outNumLines)
+static int32_t WrapStringUncached(
+    u8string_view text, int32_t width, FontStyle fontStyle, u8string* outWrappedText, int32_t* outNumLines)
 {
     constexpr size_t kNullIndex = std::numeric_limits<size_t>::max();
     u8string buffer;
@@ -181,7 +280,7 @@ int32_t GfxWrapString(u8string_view text, int32_t width, FontStyle fontStyle, u8
                 UTF8WriteCodepoint(cb, codepoint);
                 buffer.append(cb);
 
-                auto lineWidth = GfxGetStringWidth(&buffer[currentLineIndex], fontStyle);
+                auto lineWidth = TTFGetStringWidth(&buffer[currentLineIndex], fontStyle, false);
                 if (lineWidth <= width || (splitIndex == kNullIndex && bestSplitIndex == kNullIndex))
                 {
                     if (codepoint == ' ')
@@ -205,7 +304,7 @@ int32_t GfxWrapString(u8string_view text, int32_t width, FontStyle fontStyle, u8
                     buffer.insert(buffer.begin() + splitIndex, '\0');
 
                     // Recalculate the line length after splitting
-                    lineWidth = GfxGetStringWidth(&buffer[currentLineIndex], fontStyle);
+                    lineWidth = TTFGetStringWidth(&buffer[currentLineIndex], fontStyle, false);
                     maxWidth = std::max(maxWidth, lineWidth);
                     numLines++;
 
@@ -225,7 +324,7 @@ int32_t GfxWrapString(u8string_view text, int32_t width, FontStyle fontStyle, u8
         {
             buffer.push_back('\0');
 
-            auto lineWidth = GfxGetStringWidth(&buffer[currentLineIndex], fontStyle);
+            auto lineWidth = TTFGetStringWidth(&buffer[currentLineIndex], fontStyle, false);
             maxWidth = std::max(maxWidth, lineWidth);
             numLines++;
 
@@ -240,7 +339,7 @@ int32_t GfxWrapString(u8string_view text, int32_t width, FontStyle fontStyle, u8
     }
     {
         // Final line width calculation
-        auto lineWidth = GfxGetStringWidth(&buffer[currentLineIndex], fontStyle);
+        auto lineWidth = TTFGetStringWidth(&buffer[currentLineIndex], fontStyle, false);
         maxWidth = std::max(maxWidth, lineWidth);
     }
 
@@ -255,6 +354,49 @@ int32_t GfxWrapString(u8string_view text, int32_t width, FontStyle fontStyle, u8
     return maxWidth;
 }
 
+int32_t GfxClipString(utf8* text, int32_t width, FontStyle fontStyle)
+{
+    auto& cache = GetTextLayoutCache();
+    const auto key = GetTextLayoutKey(cache, text, fontStyle, width);
+    if (auto it = cache.Clipped.find(key); it != cache.Clipped.end())
+    {
+        // Clipping never makes the text longer, so it still fits the buffer.
+        std::strcpy(text, it->second.Text.c_str());
+        return it->second.Width;
+    }
+
+    ClippedStringLayout layout;
+    layout.Width = ClipStringUncached(text, width, fontStyle);
+    layout.Text = text;
+    return AddTextLayout(cache.Clipped, kMaxCachedStringLayouts, key, std::move(layout)).Width;
+}
+
+int32_t GfxWrapString(u8string_view text, int32_t width, FontStyle fontStyle, u8string* outWrappedText, int32_t* outNumLines)
+{
+    auto& cache = GetTextLayoutCache();
+    const auto key = GetTextLayoutKey(cache, text, fontStyle, width);
+    auto it = cache.Wrapped.find(key);
+    const auto& layout = [&]() -> const WrappedStringLayout& {
+        if (it != cache.Wrapped.end())
+        {
+            return it->second;
+        }
+        WrappedStringLayout newLayout;
+        newLayout.MaxWidth = WrapStringUncached(text, width, fontStyle, &newLayout.Text, &newLayout.NumLines);
+        return AddTextLayout(cache.Wrapped, kMaxCachedStringLayouts, key, std::move(newLayout));
+    }();
+
+    if (outWrappedText != nullptr)
+    {
+        *outWrappedText = layout.Text;
+    }
+    if (outNumLines != nullptr)
+    {
+        *outNumLines = layout.NumLines;
+    }
+    return layout.MaxWidth;
+}
+
 /**
  * Draws text that is left aligned and vertically centred.
  */
@@ -520,11 +662,11 @@ static void TTFDrawStringRawTTF(DrawPixelInfo& dpi, std::string_view text, TextD
 
     if (info->flags & TEXT_DRAW_FLAG_NO_DRAW)
     {
-        info->x += TTFGetWidthCacheGetOrAdd(fontDesc->font, text);
+        info->x += TTFGetStringWidth(fontDesc->font, text);
         return;
     }
 
-    TTFSurface* surface = TTFSurfaceCacheGetOrAdd(fontDesc->font, text);
+    const TTFSurface* surface = TTFRenderString(fontDesc->font, text);
     if (surface == nullptr)
         return;
 
@@ -678,6 +678,158 @@ void MaskFn(
     MaskFunc(width, height, maskSrc, colourSrc, dst, maskWrap, colourWrap, dstWrap);
 }
 
+void PaletteLookupScalar(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint32_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap,
+    const uint32_t* RESTRICT palette)
+{
+    for (int32_t yy = 0; yy < height; yy++)
+    {
+        for (int32_t xx = 0; xx < width; xx++)
+        {
+            *dst++ = palette[*src++];
+        }
+        src += srcWrap;
+        dst += dstWrap;
+    }
+}
+
+static auto GetPaletteLookupFunction()
+{
+    // There is no gather instruction before AVX2, SSE4.1 would not be faster than the scalar version.
+    if (Platform::AVX2Available())
+    {
+        LOG_VERBOSE("registering AVX2 palette lookup function");
+        return PaletteLookupAvx2;
+    }
+    else
+    {
+        LOG_VERBOSE("registering scalar palette lookup function");
+        return PaletteLookupScalar;
+    }
+}
+
+static const auto PaletteLookupFunc = GetPaletteLookupFunction();
+
+void PaletteLookupFn(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint32_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap,
+    const uint32_t* RESTRICT palette)
+{
+    PaletteLookupFunc(width, height, src, dst, srcWrap, dstWrap, palette);
+}
+
+void LightAccumulateScalar(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap,
+    uint8_t intensity)
+{
+    // A full intensity of 255 scales by 256 / 256, so it needs no special case.
+    const uint32_t scale = intensity + 1;
+    for (int32_t yy = 0; yy < height; yy++)
+    {
+        for (int32_t xx = 0; xx < width; xx++)
+        {
+            *dst = static_cast<uint8_t>(std::min<uint32_t>(0xFF, *dst + ((*src * scale) >> 8)));
+            dst++;
+            src++;
+        }
+        src += srcWrap;
+        dst += dstWrap;
+    }
+}
+
+static auto GetLightAccumulateFunction()
+{
+    if (Platform::AVX2Available())
+    {
+        LOG_VERBOSE("registering AVX2 light accumulate function");
+        return LightAccumulateAvx2;
+    }
+    else if (Platform::SSE41Available())
+    {
+        LOG_VERBOSE("registering SSE4.1 light accumulate function");
+        return LightAccumulateSse4_1;
+    }
+    else
+    {
+        LOG_VERBOSE("registering scalar light accumulate function");
+        return LightAccumulateScalar;
+    }
+}
+
+static const auto LightAccumulateFunc = GetLightAccumulateFunction();
+
+void LightAccumulateFn(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap,
+    uint8_t intensity)
+{
+    LightAccumulateFunc(width, height, src, dst, srcWrap, dstWrap, intensity);
+}
+
+void LightBlendScalar(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, const uint8_t* RESTRICT light, uint32_t* RESTRICT dst,
+    int32_t srcWrap, int32_t lightWrap, int32_t dstWrap, const uint32_t* RESTRICT palette,
+    const uint32_t* RESTRICT lightPalette)
+{
+    for (int32_t yy = 0; yy < height; yy++)
+    {
+        for (int32_t xx = 0; xx < width; xx++)
+        {
+            const uint32_t darkColour = palette[*src];
+            const uint32_t intensity = *light * 6;
+            if (intensity == 0)
+            {
+                *dst = darkColour;
+            }
+            else
+            {
+                const uint32_t lightColour = lightPalette[*src];
+                uint32_t colour = 0;
+                for (uint32_t shift = 0; shift < 32; shift += 8)
+                {
+                    const uint32_t a = (darkColour >> shift) & 0xFF;
+                    const uint32_t b = (lightColour >> shift) & 0xFF;
+                    colour |= std::min<uint32_t>(0xFF, a + ((b * intensity) >> 8)) << shift;
+                }
+                *dst = colour;
+            }
+            src++;
+            light++;
+            dst++;
+        }
+        src += srcWrap;
+        light += lightWrap;
+        dst += dstWrap;
+    }
+}
+
+static auto GetLightBlendFunction()
+{
+    if (Platform::AVX2Available())
+    {
+        LOG_VERBOSE("registering AVX2 light blend function");
+        return LightBlendAvx2;
+    }
+    else if (Platform::SSE41Available())
+    {
+        LOG_VERBOSE("registering SSE4.1 light blend function");
+        return LightBlendSse4_1;
+    }
+    else
+    {
+        LOG_VERBOSE("registering scalar light blend function");
+        return LightBlendScalar;
+    }
+}
+
+static const auto LightBlendFunc = GetLightBlendFunction();
+
+void LightBlendFn(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, const uint8_t* RESTRICT light, uint32_t* RESTRICT dst,
+    int32_t srcWrap, int32_t lightWrap, int32_t dstWrap, const uint32_t* RESTRICT palette,
+    const uint32_t* RESTRICT lightPalette)
+{
+    LightBlendFunc(width, height, src, light, dst, srcWrap, lightWrap, dstWrap, palette, lightPalette);
+}
+
 void GfxFilterPixel(DrawPixelInfo& dpi, const ScreenCoordsXY& coords, FilterPaletteID palette)
 {
     GfxFilterRect(dpi, { coords, coords }, palette);
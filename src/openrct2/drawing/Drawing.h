@@ -544,6 +544,18 @@ bool IsCsgLoaded();
 void FASTCALL GfxSpriteToBuffer(DrawPixelInfo& dpi, const DrawSpriteArgs& args);
 void FASTCALL GfxBmpSpriteToBuffer(DrawPixelInfo& dpi, const DrawSpriteArgs& args);
 void FASTCALL GfxRleSpriteToBuffer(DrawPixelInfo& dpi, const DrawSpriteArgs& args);
+
+/**
+ * Sprite drawing kernels are specialised at compile time for every combination of sprite format, blend op and zoom level.
+ * Looking one up once per sprite keeps the image flag and zoom checks out of the pixel loops.
+ */
+using SpriteBlitFunc = void(FASTCALL*)(DrawPixelInfo& dpi, const DrawSpriteArgs& args);
+constexpr int8_t kSpriteBlitterMinZoom = -2;
+constexpr size_t kSpriteBlitterZoomLevels = 6;
+
+SpriteBlitFunc GfxGetSpriteBlitter(const DrawSpriteArgs& args, ZoomLevel zoom);
+SpriteBlitFunc GfxGetBmpSpriteBlitter(ImageId image, const G1Element& g1, ZoomLevel zoom);
+SpriteBlitFunc GfxGetRleSpriteBlitter(ImageId image, ZoomLevel zoom);
 void FASTCALL GfxDrawSprite(DrawPixelInfo& dpi, const ImageId image_id, const ScreenCoordsXY& coords);
 void FASTCALL GfxDrawGlyph(DrawPixelInfo& dpi, const ImageId image, const ScreenCoordsXY& coords, const PaletteMap& paletteMap);
 void FASTCALL GfxDrawSpriteSolid(DrawPixelInfo& dpi, const ImageId image, const ScreenCoordsXY& coords, uint8_t colour);
@@ -573,6 +585,8 @@ int32_t GfxGetStringWidthNewLined(std::string_view text, FontStyle fontStyle);
 int32_t GfxGetStringWidthNoFormatting(std::string_view text, FontStyle fontStyle);
 int32_t StringGetHeightRaw(std::string_view text, FontStyle fontStyle);
 int32_t GfxClipString(char* buffer, int32_t width, FontStyle fontStyle);
+// Drops the cached string widths and layouts, needed whenever the fonts change.
+void GfxInvalidateTextLayoutCache();
 u8string ShortenPath(const u8string& path, int32_t availableWidth, FontStyle fontStyle);
 void TTFDrawString(
     DrawPixelInfo& dpi, const_utf8string text, ColourWithFlags colour, const ScreenCoordsXY& coords, bool noFormatting,
@@ -603,6 +617,52 @@ void MaskFn(
     int32_t width, int32_t height, const uint8_t* RESTRICT maskSrc, const uint8_t* RESTRICT colourSrc, uint8_t* RESTRICT dst,
     int32_t maskWrap, int32_t colourWrap, int32_t dstWrap);
 
+// Converts a rectangle of 8-bit palette indices to 32-bit pixels by looking each index up in the given palette.
+void PaletteLookupScalar(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint32_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap,
+    const uint32_t* RESTRICT palette);
+void PaletteLookupAvx2(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint32_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap,
+    const uint32_t* RESTRICT palette);
+
+void PaletteLookupFn(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint32_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap,
+    const uint32_t* RESTRICT palette);
+
+// Adds a light texture to the light map, scaled by (intensity + 1) / 256 and saturating at 255.
+void LightAccumulateScalar(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap,
+    uint8_t intensity);
+void LightAccumulateSse4_1(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap,
+    uint8_t intensity);
+void LightAccumulateAvx2(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap,
+    uint8_t intensity);
+
+void LightAccumulateFn(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap,
+    uint8_t intensity);
+
+// Converts palette indices to 32-bit pixels, adding the lit palette colour scaled by the light map to every channel.
+void LightBlendScalar(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, const uint8_t* RESTRICT light, uint32_t* RESTRICT dst,
+    int32_t srcWrap, int32_t lightWrap, int32_t dstWrap, const uint32_t* RESTRICT palette,
+    const uint32_t* RESTRICT lightPalette);
+void LightBlendSse4_1(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, const uint8_t* RESTRICT light, uint32_t* RESTRICT dst,
+    int32_t srcWrap, int32_t lightWrap, int32_t dstWrap, const uint32_t* RESTRICT palette,
+    const uint32_t* RESTRICT lightPalette);
+void LightBlendAvx2(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, const uint8_t* RESTRICT light, uint32_t* RESTRICT dst,
+    int32_t srcWrap, int32_t lightWrap, int32_t dstWrap, const uint32_t* RESTRICT palette,
+    const uint32_t* RESTRICT lightPalette);
+
+void LightBlendFn(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, const uint8_t* RESTRICT light, uint32_t* RESTRICT dst,
+    int32_t srcWrap, int32_t lightWrap, int32_t dstWrap, const uint32_t* RESTRICT palette,
+    const uint32_t* RESTRICT lightPalette);
+
 std::optional<uint32_t> GetPaletteG1Index(colour_t paletteId);
 std::optional<PaletteMap> GetPaletteMapForColour(colour_t paletteId);
 void UpdatePalette(std::span<const OpenRCT2::Drawing::PaletteBGRA> palette, int32_t start_index, int32_t num_colours);
@@ -300,6 +300,7 @@ void FontSpriteInitialiseCharacters()
     }
 
     ScrollingTextInitialiseBitmaps();
+    GfxInvalidateTextLayoutCache();
 }
 
 int32_t FontSpriteGetCodepointOffset(int32_t codepoint)
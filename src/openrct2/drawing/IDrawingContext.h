@@ -34,7 +34,7 @@ namespace OpenRCT2::Drawing
         virtual void DrawSpriteSolid(DrawPixelInfo& dpi, const ImageId image, int32_t x, int32_t y, uint8_t colour) = 0;
         virtual void DrawGlyph(DrawPixelInfo& dpi, const ImageId image, int32_t x, int32_t y, const PaletteMap& palette) = 0;
         virtual void DrawTTFBitmap(
-            DrawPixelInfo& dpi, TextDrawInfo* info, TTFSurface* surface, int32_t x, int32_t y, uint8_t hintingThreshold)
+            DrawPixelInfo& dpi, TextDrawInfo* info, const TTFSurface* surface, int32_t x, int32_t y, uint8_t hintingThreshold)
             = 0;
     };
 
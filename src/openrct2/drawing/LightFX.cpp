@@ -581,36 +581,8 @@ namespace OpenRCT2::Drawing::LightFx
             bufReadSkip = bufReadWidth - bufWriteWidth;
             bufWriteSkip = _pixelInfo.width - bufWriteWidth;
 
-            if (entry.lightIntensity == 0xFF)
-            {
-                for (int32_t y = 0; y < bufWriteHeight; y++)
-                {
-                    for (int32_t x = 0; x < bufWriteWidth; x++)
-                    {
-                        *bufWriteBase = std::min(0xFF, *bufWriteBase + *bufReadBase);
-                        bufWriteBase++;
-                        bufReadBase++;
-                    }
-
-                    bufWriteBase += bufWriteSkip;
-                    bufReadBase += bufReadSkip;
-                }
-            }
-            else
-            {
-                for (int32_t y = 0; y < bufWriteHeight; y++)
-                {
-                    for (int32_t x = 0; x < bufWriteWidth; x++)
-                    {
-                        *bufWriteBase = std::min(0xFF, *bufWriteBase + (((*bufReadBase) * (1 + entry.lightIntensity)) >> 8));
-                        bufWriteBase++;
-                        bufReadBase++;
-                    }
-
-                    bufWriteBase += bufWriteSkip;
-                    bufReadBase += bufReadSkip;
-                }
-            }
+            LightAccumulateFn(
+                bufWriteWidth, bufWriteHeight, bufReadBase, bufWriteBase, bufReadSkip, bufWriteSkip, entry.lightIntensity);
         }
     }
 
@@ -1009,15 +981,6 @@ namespace OpenRCT2::Drawing::LightFx
         }
     }
 
-    static uint8_t MixLight(uint32_t a, uint32_t b, uint32_t intensity)
-    {
-        intensity = intensity * 6;
-        uint32_t bMul = (b * intensity) >> 8;
-        uint32_t ab = a + bMul;
-        uint8_t result = static_cast<uint8_t>(std::min<uint32_t>(255, ab));
-        return result;
-    }
-
     void RenderToTexture(
         void* dstPixels, uint32_t dstPitch, uint8_t* bits, uint32_t width, uint32_t height, const uint32_t* palette,
         const uint32_t* lightPalette)
@@ -1033,31 +996,7 @@ namespace OpenRCT2::Drawing::LightFx
             return;
         }
 
-        for (uint32_t y = 0; y < height; y++)
-        {
-            uintptr_t dstOffset = static_cast<uintptr_t>(y * dstPitch);
-            uint32_t* dst = reinterpret_cast<uint32_t*>(reinterpret_cast<uintptr_t>(dstPixels) + dstOffset);
-            for (uint32_t x = 0; x < width; x++)
-            {
-                uint8_t* src = &bits[y * width + x];
-                uint32_t darkColour = palette[*src];
-                uint32_t lightColour = lightPalette[*src];
-                uint8_t lightIntensity = lightBits[y * width + x];
-
-                uint32_t colour = 0;
-                if (lightIntensity == 0)
-                {
-                    colour = darkColour;
-                }
-                else
-                {
-                    colour |= MixLight((darkColour >> 0) & 0xFF, (lightColour >> 0) & 0xFF, lightIntensity);
-                    colour |= MixLight((darkColour >> 8) & 0xFF, (lightColour >> 8) & 0xFF, lightIntensity) << 8;
-                    colour |= MixLight((darkColour >> 16) & 0xFF, (lightColour >> 16) & 0xFF, lightIntensity) << 16;
-                    colour |= MixLight((darkColour >> 24) & 0xFF, (lightColour >> 24) & 0xFF, lightIntensity) << 24;
-                }
-                *dst++ = colour;
-            }
-        }
+        const auto dstWrap = static_cast<int32_t>(dstPitch / sizeof(uint32_t) - width);
+        LightBlendFn(width, height, bits, lightBits, static_cast<uint32_t*>(dstPixels), 0, 0, dstWrap, palette, lightPalette);
     }
 } // namespace OpenRCT2::Drawing::LightFx
@@ -12,6 +12,7 @@
 
 #ifdef __SSE4_1__
 
+    #include <cstring>
     #include <immintrin.h>
 
 void MaskSse4_1(
@@ -55,6 +56,78 @@ void MaskSse4_1(
     }
 }
 
+void LightAccumulateSse4_1(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap,
+    uint8_t intensity)
+{
+    const int32_t vectorWidth = width & ~15;
+    // The product of a light value and (intensity + 1) always fits in 16 bits.
+    const __m128i scale = _mm_set1_epi16(static_cast<int16_t>(intensity + 1));
+    const __m128i zero = {};
+    for (int32_t yy = 0; yy < height; yy++)
+    {
+        for (int32_t xx = 0; xx < vectorWidth; xx += 16)
+        {
+            const __m128i light = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + xx));
+            const __m128i lo = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(light, zero), scale), 8);
+            const __m128i hi = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(light, zero), scale), 8);
+            const __m128i dest = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + xx));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + xx), _mm_adds_epu8(dest, _mm_packus_epi16(lo, hi)));
+        }
+        LightAccumulateScalar(width - vectorWidth, 1, src + vectorWidth, dst + vectorWidth, 0, 0, intensity);
+        src += width + srcWrap;
+        dst += width + dstWrap;
+    }
+}
+
+void LightBlendSse4_1(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, const uint8_t* RESTRICT light, uint32_t* RESTRICT dst,
+    int32_t srcWrap, int32_t lightWrap, int32_t dstWrap, const uint32_t* RESTRICT palette,
+    const uint32_t* RESTRICT lightPalette)
+{
+    const int32_t vectorWidth = width & ~3;
+    const __m128i zero = {};
+    for (int32_t yy = 0; yy < height; yy++)
+    {
+        for (int32_t xx = 0; xx < vectorWidth; xx += 4)
+        {
+            const uint8_t* indices = src + xx;
+            const __m128i dark = _mm_setr_epi32(
+                palette[indices[0]], palette[indices[1]], palette[indices[2]], palette[indices[3]]);
+
+            int32_t intensities;
+            std::memcpy(&intensities, light + xx, sizeof(intensities));
+            if (intensities == 0)
+            {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + xx), dark);
+                continue;
+            }
+
+            const __m128i lit = _mm_setr_epi32(
+                lightPalette[indices[0]], lightPalette[indices[1]], lightPalette[indices[2]], lightPalette[indices[3]]);
+
+            // Each channel gets light * intensity * 6 / 256, spread the intensities over the four channels of their pixel.
+            const __m128i intensity = _mm_cvtepu8_epi32(_mm_cvtsi32_si128(intensities));
+            const __m128i scale = _mm_add_epi32(_mm_slli_epi32(intensity, 1), _mm_slli_epi32(intensity, 2));
+            const __m128i scalePairs = _mm_or_si128(scale, _mm_slli_epi32(scale, 16));
+            const __m128i scaleLo = _mm_unpacklo_epi32(scalePairs, scalePairs);
+            const __m128i scaleHi = _mm_unpackhi_epi32(scalePairs, scalePairs);
+
+            // (light << 8) * scale >> 16 is exactly light * scale >> 8 without overflowing 16 bits.
+            const __m128i addLo = _mm_mulhi_epu16(_mm_slli_epi16(_mm_unpacklo_epi8(lit, zero), 8), scaleLo);
+            const __m128i addHi = _mm_mulhi_epu16(_mm_slli_epi16(_mm_unpackhi_epi8(lit, zero), 8), scaleHi);
+            const __m128i lo = _mm_add_epi16(_mm_unpacklo_epi8(dark, zero), addLo);
+            const __m128i hi = _mm_add_epi16(_mm_unpackhi_epi8(dark, zero), addHi);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + xx), _mm_packus_epi16(lo, hi));
+        }
+        LightBlendScalar(
+            width - vectorWidth, 1, src + vectorWidth, light + vectorWidth, dst + vectorWidth, 0, 0, 0, palette, lightPalette);
+        src += width + srcWrap;
+        light += width + lightWrap;
+        dst += width + dstWrap;
+    }
+}
+
 #else
 
     #ifdef OPENRCT2_X86
@@ -68,4 +141,19 @@ void MaskSse4_1(
     OpenRCT2::Guard::Fail("SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
 }
 
+void LightAccumulateSse4_1(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap,
+    uint8_t intensity)
+{
+    OpenRCT2::Guard::Fail("SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
+}
+
+void LightBlendSse4_1(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, const uint8_t* RESTRICT light, uint32_t* RESTRICT dst,
+    int32_t srcWrap, int32_t lightWrap, int32_t dstWrap, const uint32_t* RESTRICT palette,
+    const uint32_t* RESTRICT lightPalette)
+{
+    OpenRCT2::Guard::Fail("SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
+}
+
 #endif // __SSE4_1__
@@ -1575,7 +1575,7 @@ static void ScrollingTextSetBitmapForTTF(
         }
     }
 
-    auto surface = TTFSurfaceCacheGetOrAdd(fontDesc->font, ttfBuffer.c_str());
+    auto surface = TTFRenderString(fontDesc->font, ttfBuffer);
     if (surface == nullptr)
     {
         return;
@@ -11,66 +11,87 @@
 
     #include "../Diagnostic.h"
 
+    #include <algorithm>
+    #include <array>
+    #include <atomic>
+    #include <cstdint>
+    #include <memory>
     #include <mutex>
+    #include <shared_mutex>
+    #include <unordered_map>
+    #include <vector>
     #pragma clang diagnostic push
     #pragma clang diagnostic ignored "-Wdocumentation"
     #include <ft2build.h>
     #include FT_FREETYPE_H
     #pragma clang diagnostic pop
 
-    #include "../OpenRCT2.h"
+    #include "../core/CodepointView.hpp"
     #include "../core/EnumUtils.hpp"
-    #include "../core/Numerics.hpp"
-    #include "../core/String.hpp"
     #include "../drawing/Font.h"
     #include "../localisation/LocalisationService.h"
     #include "../platform/Platform.h"
+    #include "../profiling/Profiling.h"
+    #include "Drawing.h"
     #include "DrawingLock.hpp"
     #include "TTF.h"
 
 using namespace OpenRCT2;
 
-static bool _ttfInitialised = false;
+static std::atomic<bool> _ttfInitialised = false;
 
-constexpr int32_t kTTFSurfaceCacheSize = 256;
-constexpr int32_t kTTFGetWidthCacheSize = 1024;
+// Glyphs for codepoints below this are kept in a table that is read without taking any lock.
+constexpr size_t kTTFGlyphTableSize = 0x800;
 
-struct ttf_cache_entry
+// Kerning row entries not looked up yet.
+constexpr int16_t kTTFKerningUnknown = INT16_MIN;
+
+constexpr uint16_t kUnicodeBomNative = 0xFEFF;
+constexpr uint16_t kUnicodeBomSwapped = 0xFFFE;
+
+/**
+ * The glyphs loaded for one of the fonts. Glyphs are never changed or freed once they have been published, until the
+ * whole cache is cleared when the fonts or their hinting change, which only happens while nothing is being drawn.
+ */
+struct TTFFontGlyphCache
 {
-    TTFSurface* surface;
-    TTF_Font* font;
-    u8string text;
-    uint32_t lastUseTick;
+    TTF_Font* Font{};
+    bool Shaded{};
+    bool Kerning{};
+
+    std::array<std::atomic<const TTFGlyph*>, kTTFGlyphTableSize> Table{};
+    // Kerning between two glyphs of the table, one row per codepoint that was followed by another, read without taking
+    // any lock like the table.
+    std::array<std::atomic<std::atomic<int16_t>*>, kTTFGlyphTableSize> KerningRows{};
+
+    // Glyphs outside of the table and kerning between pairs of glyph indices involving them.
+    std::shared_mutex Mutex;
+    std::unordered_map<uint16_t, const TTFGlyph*> Glyphs;
+    std::unordered_map<uint64_t, int32_t> KerningPairs;
+
+    // Serialises FreeType access, the face and the port's own glyph slots are not thread safe.
+    std::mutex LoadMutex;
+    std::vector<std::unique_ptr<TTFGlyph>> Storage;
+    std::vector<std::unique_ptr<std::atomic<int16_t>[]>> KerningRowStorage;
 };
 
-struct ttf_getwidth_cache_entry
+struct TTFLayoutGlyph
 {
-    uint32_t width;
-    TTF_Font* font;
-    u8string text;
-    uint32_t lastUseTick;
+    const TTFGlyph* Glyph;
+    int32_t Kerning;
 };
 
-static ttf_cache_entry _ttfSurfaceCache[kTTFSurfaceCacheSize] = {};
-static int32_t _ttfSurfaceCacheCount = 0;
-static int32_t _ttfSurfaceCacheHitCount = 0;
-static int32_t _ttfSurfaceCacheMissCount = 0;
-
-static ttf_getwidth_cache_entry _ttfGetWidthCache[kTTFGetWidthCacheSize] = {};
-static int32_t _ttfGetWidthCacheCount = 0;
-static int32_t _ttfGetWidthCacheHitCount = 0;
-static int32_t _ttfGetWidthCacheMissCount = 0;
+static std::array<TTFFontGlyphCache, FontStyleCount> _glyphCaches;
+static std::atomic<uint64_t> _glyphCacheLookups;
+static std::atomic<uint64_t> _glyphCacheMisses;
 
 static std::mutex _mutex;
 
 static TTF_Font* TTFOpenFont(const utf8* fontPath, int32_t ptSize);
 static void TTFCloseFont(TTF_Font* font);
-static void TTFSurfaceCacheDispose(ttf_cache_entry* entry);
-static void TTFSurfaceCacheDisposeAll();
-static void TTFGetWidthCacheDisposeAll();
-static bool TTFGetSize(TTF_Font* font, std::string_view text, int32_t* outWidth, int32_t* outHeight);
+static void TTFGlyphCacheClearAll();
 static void TTFToggleHinting(bool);
-static TTFSurface* TTFRender(TTF_Font* font, std::string_view text);
+static void TTFGlyphCacheSetFonts();
 
 static void TTFToggleHinting(bool)
 {
@@ -79,21 +100,35 @@ static void TTFToggleHinting(bool)
         return;
     }
 
+    // Glyphs are rendered differently with hinting, so they all have to be loaded again.
+    TTFGlyphCacheClearAll();
+
     for (int32_t i = 0; i < FontStyleCount; i++)
     {
         TTFFontDescriptor* fontDesc = &(gCurrentTTFFontSet->size[i]);
         bool use_hinting = Config::Get().fonts.EnableHinting && fontDesc->hinting_threshold;
         TTF_SetFontHinting(fontDesc->font, use_hinting ? 1 : 0);
     }
+}
 
-    if (_ttfSurfaceCacheCount)
+static void TTFGlyphCacheSetFonts()
+{
+    for (int32_t i = 0; i < FontStyleCount; i++)
     {
-        TTFSurfaceCacheDisposeAll();
+        TTF_Font* font = gCurrentTTFFontSet->size[i].font;
+        auto& cache = _glyphCaches[i];
+        cache.Font = font;
+        cache.Shaded = TTF_GetFontHinting(font) != 0;
+        cache.Kerning = TTF_GetFontKerning(font) != 0;
     }
 }
 
 bool TTFInitialise()
 {
+    // Checked for every string that is drawn, so only lock when there is something to do.
+    if (_ttfInitialised)
+        return true;
+
     DrawingUniqueLock<std::mutex> lock(_mutex);
 
     if (_ttfInitialised)
@@ -125,6 +160,7 @@ bool TTFInitialise()
     }
 
     TTFToggleHinting(true);
+    TTFGlyphCacheSetFonts();
 
     _ttfInitialised = true;
 
@@ -138,8 +174,7 @@ void TTFDispose()
     if (!_ttfInitialised)
         return;
 
-    TTFSurfaceCacheDisposeAll();
-    TTFGetWidthCacheDisposeAll();
+    TTFGlyphCacheClearAll();
 
     for (int32_t i = 0; i < FontStyleCount; i++)
     {
@@ -149,6 +184,7 @@ void TTFDispose()
             TTFCloseFont(fontDesc->font);
             fontDesc->font = nullptr;
         }
+        _glyphCaches[i].Font = nullptr;
     }
 
     TTF_Quit();
@@ -166,190 +202,294 @@ static void TTFCloseFont(TTF_Font* font)
     TTF_CloseFont(font);
 }
 
-static uint32_t TTFSurfaceCacheHash(TTF_Font* font, std::string_view text)
+static void TTFGlyphCacheClearAll()
 {
-    uint32_t hash = static_cast<uint32_t>(((reinterpret_cast<uintptr_t>(font) * 23) ^ 0xAAAAAAAA) & 0xFFFFFFFF);
-    for (auto c : text)
+    for (auto& cache : _glyphCaches)
     {
-        hash = Numerics::ror32(hash, 3) ^ (c * 13);
+        std::scoped_lock lock(cache.LoadMutex, cache.Mutex);
+        for (auto& glyph : cache.Table)
+        {
+            glyph.store(nullptr, std::memory_order_relaxed);
+        }
+        for (auto& row : cache.KerningRows)
+        {
+            row.store(nullptr, std::memory_order_relaxed);
+        }
+        cache.Glyphs.clear();
+        cache.KerningPairs.clear();
+        cache.Storage.clear();
+        cache.KerningRowStorage.clear();
     }
-    return hash;
 }
 
-static void TTFSurfaceCacheDispose(ttf_cache_entry* entry)
+void TTFToggleHinting()
 {
-    if (entry->surface != nullptr)
+    DrawingUniqueLock<std::mutex> lock(_mutex);
+    if (!_ttfInitialised)
+        return;
+
+    TTFToggleHinting(true);
+    TTFGlyphCacheSetFonts();
+    GfxInvalidateTextLayoutCache();
+}
+
+static TTFFontGlyphCache* TTFGetGlyphCache(const TTF_Font* font)
+{
+    for (auto& cache : _glyphCaches)
     {
-        TTFFreeSurface(entry->surface);
-        entry->text.clear();
-        entry->surface = nullptr;
-        entry->font = nullptr;
+        if (cache.Font == font)
+            return &cache;
     }
+    return nullptr;
 }
 
-static void TTFSurfaceCacheDisposeAll()
+static const TTFGlyph* TTFLoadGlyph(TTFFontGlyphCache& cache, uint16_t codepoint)
 {
-    for (int32_t i = 0; i < kTTFSurfaceCacheSize; i++)
+    PROFILED_FUNCTION();
+
+    std::scoped_lock lock(cache.LoadMutex);
+
+    // Another thread may have loaded the glyph while this one was waiting.
+    if (codepoint < kTTFGlyphTableSize)
     {
-        TTFSurfaceCacheDispose(&_ttfSurfaceCache[i]);
-        _ttfSurfaceCacheCount--;
+        if (const auto* glyph = cache.Table[codepoint].load(std::memory_order_acquire); glyph != nullptr)
+            return glyph;
     }
+    else
+    {
+        std::shared_lock glyphsLock(cache.Mutex);
+        if (auto it = cache.Glyphs.find(codepoint); it != cache.Glyphs.end())
+            return it->second;
+    }
+
+    auto glyph = std::make_unique<TTFGlyph>();
+    if (TTF_GetGlyph(cache.Font, codepoint, cache.Shaded, glyph.get()) != 0)
+    {
+        return nullptr;
+    }
+    _glyphCacheMisses.fetch_add(1, std::memory_order_relaxed);
+
+    const auto* result = cache.Storage.emplace_back(std::move(glyph)).get();
+    if (codepoint < kTTFGlyphTableSize)
+    {
+        cache.Table[codepoint].store(result, std::memory_order_release);
+    }
+    else
+    {
+        std::unique_lock glyphsLock(cache.Mutex);
+        cache.Glyphs.emplace(codepoint, result);
+    }
+    return result;
 }
 
-void TTFToggleHinting()
+static const TTFGlyph* TTFGetGlyph(TTFFontGlyphCache& cache, uint16_t codepoint)
 {
-    DrawingUniqueLock<std::mutex> lock(_mutex);
-    TTFToggleHinting(true);
+    if (codepoint < kTTFGlyphTableSize)
+    {
+        if (const auto* glyph = cache.Table[codepoint].load(std::memory_order_acquire); glyph != nullptr)
+            return glyph;
+    }
+    else
+    {
+        std::shared_lock lock(cache.Mutex);
+        if (auto it = cache.Glyphs.find(codepoint); it != cache.Glyphs.end())
+            return it->second;
+    }
+    return TTFLoadGlyph(cache, codepoint);
 }
 
-TTFSurface* TTFSurfaceCacheGetOrAdd(TTF_Font* font, std::string_view text)
+static int32_t TTFLoadTableKerning(
+    TTFFontGlyphCache& cache, uint16_t previousCodepoint, uint32_t previousIndex, uint16_t codepoint, uint32_t index)
 {
-    ttf_cache_entry* entry;
+    std::scoped_lock lock(cache.LoadMutex);
 
-    uint32_t hash = TTFSurfaceCacheHash(font, text);
-    int32_t index = hash % kTTFSurfaceCacheSize;
-
-    DrawingUniqueLock<std::mutex> lock(_mutex);
-
-    for (int32_t i = 0; i < kTTFSurfaceCacheSize; i++)
+    auto* row = cache.KerningRows[previousCodepoint].load(std::memory_order_acquire);
+    if (row == nullptr)
     {
-        entry = &_ttfSurfaceCache[index];
-
-        // Check if entry is a hit
-        if (entry->surface == nullptr)
-            break;
-        if (entry->font == font && String::equals(entry->text, text))
+        auto& newRow = cache.KerningRowStorage.emplace_back(new std::atomic<int16_t>[kTTFGlyphTableSize]);
+        for (size_t i = 0; i < kTTFGlyphTableSize; i++)
         {
-            _ttfSurfaceCacheHitCount++;
-            entry->lastUseTick = gCurrentDrawCount;
-            return entry->surface;
+            newRow[i].store(kTTFKerningUnknown, std::memory_order_relaxed);
         }
+        row = newRow.get();
+        cache.KerningRows[previousCodepoint].store(row, std::memory_order_release);
+    }
 
-        // If entry hasn't been used for a while, replace it
-        if (entry->lastUseTick < gCurrentDrawCount - 64)
+    const auto kerning = std::clamp<int32_t>(
+        TTF_GetFontKerningSizeGlyphs(cache.Font, previousIndex, index), INT16_MIN + 1, INT16_MAX);
+    row[codepoint].store(static_cast<int16_t>(kerning), std::memory_order_relaxed);
+    return kerning;
+}
+
+static int32_t TTFGetKerning(
+    TTFFontGlyphCache& cache, uint16_t previousCodepoint, uint32_t previousIndex, uint16_t codepoint, uint32_t index)
+{
+    if (!cache.Kerning || previousIndex == 0 || index == 0)
+        return 0;
+
+    if (previousCodepoint < kTTFGlyphTableSize && codepoint < kTTFGlyphTableSize)
+    {
+        if (const auto* row = cache.KerningRows[previousCodepoint].load(std::memory_order_acquire); row != nullptr)
         {
-            break;
+            if (const auto kerning = row[codepoint].load(std::memory_order_relaxed); kerning != kTTFKerningUnknown)
+                return kerning;
         }
-
-        // Check if next entry is a hit
-        if (++index >= kTTFSurfaceCacheSize)
-            index = 0;
+        return TTFLoadTableKerning(cache, previousCodepoint, previousIndex, codepoint, index);
     }
 
-    // Cache miss, replace entry with new surface
-    entry = &_ttfSurfaceCache[index];
-    TTFSurfaceCacheDispose(entry);
-
-    TTFSurface* surface = TTFRender(font, text);
-    if (surface == nullptr)
+    const uint64_t key = (static_cast<uint64_t>(previousIndex) << 32) | index;
     {
-        return nullptr;
+        std::shared_lock lock(cache.Mutex);
+        if (auto it = cache.KerningPairs.find(key); it != cache.KerningPairs.end())
+            return it->second;
     }
 
-    _ttfSurfaceCacheMissCount++;
-    // printf("CACHE HITS: %d   MISSES: %d)\n", _ttfSurfaceCacheHitCount, _ttfSurfaceCacheMissCount);
-
-    _ttfSurfaceCacheCount++;
-    entry->surface = surface;
-    entry->font = font;
-    entry->text = text;
-    entry->lastUseTick = gCurrentDrawCount;
-    return entry->surface;
+    std::scoped_lock lock(cache.LoadMutex);
+    const auto kerning = TTF_GetFontKerningSizeGlyphs(cache.Font, previousIndex, index);
+    std::unique_lock pairsLock(cache.Mutex);
+    cache.KerningPairs.emplace(key, kerning);
+    return kerning;
 }
 
-static void TTFGetWidthCacheDispose(ttf_getwidth_cache_entry* entry)
+/**
+ * Looks up the glyphs of the text and measures the surface needed to draw it, the same way TTF_SizeUTF8 does. Returns
+ * false if a glyph could not be loaded.
+ */
+static bool TTFLayoutString(
+    TTFFontGlyphCache& cache, std::string_view text, std::vector<TTFLayoutGlyph>& layout, int32_t* outWidth,
+    int32_t* outHeight)
 {
-    if (entry->text.empty())
-        return;
+    layout.clear();
+
+    int32_t x = 0;
+    int32_t minX = 0;
+    int32_t maxX = 0;
+    int32_t minY = 0;
+    uint32_t previousIndex = 0;
+    uint16_t previousCodepoint = 0;
+    for (auto codepoint : CodepointView(text))
+    {
+        // The FreeType port only supports the basic multilingual plane.
+        const auto ch = static_cast<uint16_t>(codepoint);
+        if (ch == kUnicodeBomNative || ch == kUnicodeBomSwapped)
+            continue;
 
-    entry->text.clear();
-    entry->width = 0;
-    entry->font = nullptr;
-}
+        const auto* glyph = TTFGetGlyph(cache, ch);
+        if (glyph == nullptr)
+            return false;
 
-static void TTFGetWidthCacheDisposeAll()
-{
-    for (int32_t i = 0; i < kTTFGetWidthCacheSize; i++)
-    {
-        TTFGetWidthCacheDispose(&_ttfGetWidthCache[i]);
-        _ttfGetWidthCacheCount--;
+        const auto kerning = TTFGetKerning(cache, previousCodepoint, previousIndex, ch, glyph->Index);
+        x += kerning;
+        minX = std::min(minX, x + glyph->MinX);
+        maxX = std::max(maxX, x + std::max(glyph->Advance, glyph->MaxX));
+        x += glyph->Advance;
+        minY = std::min(minY, glyph->MinY);
+        previousIndex = glyph->Index;
+        previousCodepoint = ch;
+
+        layout.push_back({ glyph, kerning });
     }
+    _glyphCacheLookups.fetch_add(layout.size(), std::memory_order_relaxed);
+
+    *outWidth = maxX - minX;
+    *outHeight = std::max(TTF_FontAscent(cache.Font) - minY, TTF_FontHeight(cache.Font));
+    return true;
 }
 
-uint32_t TTFGetWidthCacheGetOrAdd(TTF_Font* font, std::string_view text)
+const TTFSurface* TTFRenderString(TTF_Font* font, std::string_view text)
 {
-    ttf_getwidth_cache_entry* entry;
+    thread_local std::vector<TTFLayoutGlyph> layout;
+    thread_local std::vector<uint8_t> pixels;
+    thread_local TTFSurface surface;
 
-    uint32_t hash = TTFSurfaceCacheHash(font, text);
-    int32_t index = hash % kTTFGetWidthCacheSize;
+    auto* cache = TTFGetGlyphCache(font);
+    if (cache == nullptr)
+        return nullptr;
 
-    DrawingUniqueLock<std::mutex> lock(_mutex);
+    int32_t width;
+    int32_t height;
+    if (!TTFLayoutString(*cache, text, layout, &width, &height) || width == 0)
+        return nullptr;
 
-    for (int32_t i = 0; i < kTTFGetWidthCacheSize; i++)
-    {
-        entry = &_ttfGetWidthCache[index];
+    pixels.assign(static_cast<size_t>(width) * height, 0);
+    uint8_t* const pixelsEnd = pixels.data() + pixels.size();
 
-        // Check if entry is a hit
-        if (entry->text.empty())
-            break;
-        if (entry->font == font && String::equals(entry->text, text))
+    int32_t x = 0;
+    bool first = true;
+    for (const auto& [glyph, kerning] : layout)
+    {
+        x += kerning;
+        // Compensate for the first glyph starting left of the pen position.
+        if (first && glyph->MinX < 0)
         {
-            _ttfGetWidthCacheHitCount++;
-            entry->lastUseTick = gCurrentDrawCount;
-            return entry->width;
+            x -= glyph->MinX;
         }
+        first = false;
 
-        // If entry hasn't been used for a while, replace it
-        if (entry->lastUseTick < gCurrentDrawCount - 64)
+        for (int32_t row = 0; row < glyph->Rows; row++)
         {
-            break;
+            const int32_t y = row + glyph->YOffset;
+            if (y < 0 || y >= height)
+                continue;
+
+            auto* dst = pixels.data() + (y * width) + x + glyph->MinX;
+            const auto* src = glyph->Pixels.data() + (row * glyph->Width);
+            for (int32_t col = glyph->Width; col > 0 && dst < pixelsEnd; col--)
+            {
+                *dst++ |= *src++;
+            }
         }
-
-        // Check if next entry is a hit
-        if (++index >= kTTFGetWidthCacheSize)
-            index = 0;
+        x += glyph->Advance;
     }
 
-    // Cache miss, replace entry with new width
-    entry = &_ttfGetWidthCache[index];
-    TTFGetWidthCacheDispose(entry);
+    surface.pixels = pixels.data();
+    surface.w = width;
+    surface.h = height;
+    return &surface;
+}
 
-    int32_t width, height;
-    TTFGetSize(font, text, &width, &height);
+uint32_t TTFGetStringWidth(TTF_Font* font, std::string_view text)
+{
+    thread_local std::vector<TTFLayoutGlyph> layout;
 
-    _ttfGetWidthCacheMissCount++;
+    auto* cache = TTFGetGlyphCache(font);
+    if (cache == nullptr)
+        return 0;
 
-    _ttfGetWidthCacheCount++;
-    entry->width = width;
-    entry->font = font;
-    entry->text = text;
-    entry->lastUseTick = gCurrentDrawCount;
-    return entry->width;
+    int32_t width;
+    int32_t height;
+    if (!TTFLayoutString(*cache, text, layout, &width, &height))
+        return 0;
+    return width;
 }
 
-TTFFontDescriptor* TTFGetFontFromSpriteBase(FontStyle fontStyle)
+TTFGlyphCacheStats TTFGetGlyphCacheStats()
 {
-    DrawingUniqueLock<std::mutex> lock(_mutex);
-    return &gCurrentTTFFontSet->size[EnumValue(fontStyle)];
+    TTFGlyphCacheStats stats{};
+    stats.Lookups = _glyphCacheLookups.load(std::memory_order_relaxed);
+    stats.Misses = _glyphCacheMisses.load(std::memory_order_relaxed);
+    for (auto& cache : _glyphCaches)
+    {
+        std::scoped_lock lock(cache.LoadMutex);
+        stats.Glyphs += cache.Storage.size();
+    }
+    return stats;
 }
 
-bool TTFProvidesGlyph(const TTF_Font* font, codepoint_t codepoint)
+void TTFResetGlyphCacheStats()
 {
-    return TTF_GlyphIsProvided(font, codepoint);
+    _glyphCacheLookups = 0;
+    _glyphCacheMisses = 0;
 }
 
-static bool TTFGetSize(TTF_Font* font, std::string_view text, int32_t* outWidth, int32_t* outHeight)
+TTFFontDescriptor* TTFGetFontFromSpriteBase(FontStyle fontStyle)
 {
-    thread_local std::string buffer;
-    buffer.assign(text);
-    return TTF_SizeUTF8(font, buffer.c_str(), outWidth, outHeight);
+    return &gCurrentTTFFontSet->size[EnumValue(fontStyle)];
 }
 
-static TTFSurface* TTFRender(TTF_Font* font, std::string_view text)
+bool TTFProvidesGlyph(const TTF_Font* font, codepoint_t codepoint)
 {
-    thread_local std::string buffer;
-    buffer.assign(text);
-    return TTF_RenderUTF8(font, buffer.c_str(), TTF_GetFontHinting(font) != 0);
+    return TTF_GlyphIsProvided(font, codepoint);
 }
 
 void TTFFreeSurface(TTFSurface* surface)
@@ -12,6 +12,7 @@
 #include "Font.h"
 
 #include <string_view>
+#include <vector>
 
 bool TTFInitialise();
 void TTFDispose();
@@ -26,10 +27,35 @@ struct TTFSurface
     int32_t h;
 };
 
+// A rendered glyph with its metrics, as loaded from the font by the port.
+struct TTFGlyph
+{
+    uint32_t Index;
+    int32_t MinX;
+    int32_t MaxX;
+    int32_t MinY;
+    int32_t MaxY;
+    int32_t YOffset;
+    int32_t Advance;
+    int32_t Width;
+    int32_t Rows;
+    std::vector<uint8_t> Pixels;
+};
+
+struct TTFGlyphCacheStats
+{
+    uint64_t Lookups;
+    uint64_t Misses;
+    size_t Glyphs;
+};
+
 TTFFontDescriptor* TTFGetFontFromSpriteBase(FontStyle fontStyle);
 void TTFToggleHinting();
-TTFSurface* TTFSurfaceCacheGetOrAdd(TTF_Font* font, std::string_view text);
-uint32_t TTFGetWidthCacheGetOrAdd(TTF_Font* font, std::string_view text);
+// Composes the text from cached glyphs. The surface stays valid until the calling thread renders another string.
+const TTFSurface* TTFRenderString(TTF_Font* font, std::string_view text);
+uint32_t TTFGetStringWidth(TTF_Font* font, std::string_view text);
+TTFGlyphCacheStats TTFGetGlyphCacheStats();
+void TTFResetGlyphCacheStats();
 bool TTFProvidesGlyph(const TTF_Font* font, codepoint_t codepoint);
 void TTFFreeSurface(TTFSurface* surface);
 
@@ -39,6 +65,11 @@ TTF_Font* TTF_OpenFont(const char* file, int ptsize);
 int TTF_GlyphIsProvided(const TTF_Font* font, codepoint_t ch);
 int TTF_SizeUTF8(TTF_Font* font, const char* text, int* w, int* h);
 TTFSurface* TTF_RenderUTF8(TTF_Font* font, const char* text, bool shaded);
+int TTF_GetGlyph(TTF_Font* font, uint16_t ch, bool shaded, TTFGlyph* glyph);
+int TTF_GetFontKerning(const TTF_Font* font);
+int TTF_GetFontKerningSizeGlyphs(TTF_Font* font, uint32_t previousIndex, uint32_t index);
+int TTF_FontHeight(const TTF_Font* font);
+int TTF_FontAscent(const TTF_Font* font);
 void TTF_CloseFont(TTF_Font* font);
 void TTF_SetFontHinting(TTF_Font* font, int hinting);
 int TTF_GetFontHinting(const TTF_Font* font);
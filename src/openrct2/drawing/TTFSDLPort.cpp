@@ -1404,6 +1404,82 @@ TTFSurface* TTF_RenderUTF8(TTF_Font* font, const char* text, bool shaded)
     return textbuf;
 }
 
+int TTF_GetGlyph(TTF_Font* font, uint16_t ch, bool shaded, TTFGlyph* glyph)
+{
+    c_glyph* cached;
+    FT_Bitmap* current;
+    FT_Error error;
+    int width;
+
+    TTF_CHECKPOINTER(glyph, -1);
+
+    error = Find_Glyph(font, ch, CACHED_METRICS | (shaded ? CACHED_PIXMAP : CACHED_BITMAP));
+    if (error)
+    {
+        TTF_SetFTError("Couldn't find glyph", error);
+        return -1;
+    }
+    cached = font->current;
+    current = shaded ? &cached->pixmap : &cached->bitmap;
+
+    /* Same width correction as TTF_RenderUTF8 */
+    width = current->width;
+    if (font->outline <= 0 && width > cached->maxx - cached->minx)
+    {
+        width = cached->maxx - cached->minx;
+    }
+    if (width < 0)
+    {
+        width = 0;
+    }
+
+    glyph->Index = cached->index;
+    glyph->MinX = cached->minx;
+    glyph->MaxX = cached->maxx;
+    glyph->MinY = cached->miny;
+    glyph->MaxY = cached->maxy;
+    glyph->YOffset = cached->yoffset;
+    glyph->Advance = cached->advance;
+    glyph->Width = width;
+    glyph->Rows = current->rows;
+    glyph->Pixels.resize(static_cast<size_t>(width) * current->rows);
+    for (unsigned int row = 0; row < current->rows; ++row)
+    {
+        memcpy(glyph->Pixels.data() + row * width, current->buffer + row * current->pitch, width);
+    }
+    return 0;
+}
+
+int TTF_GetFontKerning(const TTF_Font* font)
+{
+    return FT_HAS_KERNING(font->face) && font->kerning;
+}
+
+int TTF_GetFontKerningSizeGlyphs(TTF_Font* font, uint32_t previousIndex, uint32_t index)
+{
+    FT_Vector delta;
+
+    if (!TTF_GetFontKerning(font) || !previousIndex || !index)
+    {
+        return 0;
+    }
+    if (FT_Get_Kerning(font->face, previousIndex, index, ft_kerning_default, &delta))
+    {
+        return 0;
+    }
+    return delta.x >> 6;
+}
+
+int TTF_FontHeight(const TTF_Font* font)
+{
+    return font->height;
+}
+
+int TTF_FontAscent(const TTF_Font* font)
+{
+    return font->ascent;
+}
+
 void TTF_SetFontHinting(TTF_Font* font, int hinting)
 {
     if (hinting == TTF_HINTING_LIGHT)
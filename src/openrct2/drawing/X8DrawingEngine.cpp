@@ -45,6 +45,11 @@ void X8WeatherDrawer::Draw(
     DrawPixelInfo& dpi, int32_t x, int32_t y, int32_t width, int32_t height, int32_t xStart, int32_t yStart,
     const uint8_t* weatherpattern)
 {
+    _drawnLeft = std::min(_drawnLeft, x);
+    _drawnTop = std::min(_drawnTop, y);
+    _drawnRight = std::max(_drawnRight, x + width);
+    _drawnBottom = std::max(_drawnBottom, y + height);
+
     const uint8_t* pattern = weatherpattern;
     auto patternXSpace = *pattern++;
     auto patternYSpace = *pattern++;
@@ -109,6 +114,202 @@ void X8WeatherDrawer::Restore(DrawPixelInfo& dpi)
         }
         _weatherPixelsCount = 0;
     }
+    _drawnLeft = INT32_MAX;
+    _drawnTop = INT32_MAX;
+    _drawnRight = INT32_MIN;
+    _drawnBottom = INT32_MIN;
+}
+
+void X8WeatherDrawer::InvalidateDrawnArea(PresentDirtyGrid& grid) const
+{
+    if (_drawnLeft < _drawnRight && _drawnTop < _drawnBottom)
+    {
+        grid.Invalidate(_drawnLeft, _drawnTop, _drawnRight, _drawnBottom);
+    }
+}
+
+void PresentDirtyGrid::Configure(uint32_t width, uint32_t height, uint32_t blockShiftX, uint32_t blockShiftY)
+{
+    _width = width;
+    _height = height;
+    _blockShiftX = blockShiftX;
+    _blockShiftY = blockShiftY;
+    _blockColumns = (width >> blockShiftX) + 1;
+    _blockRows = (height >> blockShiftY) + 1;
+    _blocks.assign(_blockColumns * _blockRows, 0);
+    _all = true;
+}
+
+void PresentDirtyGrid::Invalidate(int32_t left, int32_t top, int32_t right, int32_t bottom)
+{
+    left = std::max(left, 0);
+    top = std::max(top, 0);
+    right = std::min(right, static_cast<int32_t>(_width));
+    bottom = std::min(bottom, static_cast<int32_t>(_height));
+    if (_all || left >= right || top >= bottom)
+        return;
+
+    const uint32_t blockLeft = left >> _blockShiftX;
+    const uint32_t blockRight = (right - 1) >> _blockShiftX;
+    const uint32_t blockTop = top >> _blockShiftY;
+    const uint32_t blockBottom = (bottom - 1) >> _blockShiftY;
+    for (uint32_t y = blockTop; y <= blockBottom; y++)
+    {
+        std::fill_n(&_blocks[y * _blockColumns + blockLeft], blockRight - blockLeft + 1, 1);
+    }
+}
+
+void PresentDirtyGrid::InvalidateAll()
+{
+    _all = true;
+}
+
+// Whether any byte of row lies in first .. first + span, testing 8 bytes at a time. span has to be below 128.
+static bool RowHasPaletteRange(const uint8_t* row, uint32_t width, uint8_t first, uint8_t span)
+{
+    constexpr uint64_t kOnes = 0x0101010101010101ULL;
+    constexpr uint64_t kHighBits = 0x8080808080808080ULL;
+    const uint64_t firsts = kOnes * first;
+    const uint64_t limits = kOnes * (span + 1u);
+
+    uint64_t found = 0;
+    uint32_t x = 0;
+    for (; x + 8 <= width; x += 8)
+    {
+        uint64_t word;
+        std::memcpy(&word, row + x, sizeof(word));
+        // Per byte word - first without borrowing into the neighbouring bytes, then per byte whether that is < span + 1.
+        const uint64_t offsets = ((word | kHighBits) - (firsts & ~kHighBits)) ^ ((word ^ ~firsts) & kHighBits);
+        found |= (offsets - limits) & ~offsets & kHighBits;
+    }
+    for (; x < width; x++)
+    {
+        found |= static_cast<uint8_t>(row[x] - first) <= span;
+    }
+    return found != 0;
+}
+
+static bool BlockUsesPaletteEntries(
+    const uint8_t* bits, uint32_t pitch, uint32_t width, uint32_t height, const std::array<bool, 256>& entries,
+    uint8_t first, uint8_t span)
+{
+    for (uint32_t y = 0; y < height; y++)
+    {
+        const uint8_t* row = bits + y * pitch;
+        // The range test is exact for the usual case of one animated range of entries, only rows with a pixel inside
+        // the range need checking against the set.
+        if ((span >= 128 || RowHasPaletteRange(row, width, first, span))
+            && std::any_of(row, row + width, [&](uint8_t index) { return entries[index]; }))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void PresentDirtyGrid::InvalidatePaletteEntries(const uint8_t* bits, uint32_t pitch, const std::array<bool, 256>& entries)
+{
+    if (_all)
+        return;
+
+    const auto first = std::find(entries.begin(), entries.end(), true);
+    if (first == entries.end())
+        return;
+    const auto last = std::find(entries.rbegin(), entries.rend(), true);
+    const auto firstIndex = static_cast<uint8_t>(first - entries.begin());
+    const auto lastIndex = static_cast<uint8_t>(entries.rend() - last - 1);
+    const auto span = static_cast<uint8_t>(lastIndex - firstIndex);
+
+    const uint32_t blockWidth = 1u << _blockShiftX;
+    const uint32_t blockHeight = 1u << _blockShiftY;
+    for (uint32_t y = 0; y < _blockRows; y++)
+    {
+        const uint32_t top = y * blockHeight;
+        if (top >= _height)
+            break;
+
+        const uint32_t height = std::min(blockHeight, _height - top);
+        for (uint32_t x = 0; x < _blockColumns; x++)
+        {
+            const uint32_t left = x * blockWidth;
+            if (left >= _width)
+                break;
+
+            auto& block = _blocks[y * _blockColumns + x];
+            const uint32_t width = std::min(blockWidth, _width - left);
+            if (block == 0
+                && BlockUsesPaletteEntries(bits + top * pitch + left, pitch, width, height, entries, firstIndex, span))
+            {
+                block = 1;
+            }
+        }
+    }
+}
+
+void PresentDirtyGrid::TakeRects(std::vector<PresentRect>& rects)
+{
+    rects.clear();
+    if (_all)
+    {
+        if (_width != 0 && _height != 0)
+        {
+            rects.push_back({ 0, 0, _width, _height });
+        }
+        std::fill(_blocks.begin(), _blocks.end(), 0);
+        _all = false;
+        return;
+    }
+
+    // Runs of changed blocks on a row extend the rectangle from the row above if it covers the same columns.
+    const uint32_t blockWidth = 1u << _blockShiftX;
+    const uint32_t blockHeight = 1u << _blockShiftY;
+    std::vector<size_t> openRects;
+    std::vector<size_t> nextOpenRects;
+    for (uint32_t y = 0; y < _blockRows; y++)
+    {
+        auto* row = &_blocks[y * _blockColumns];
+        const uint32_t top = y * blockHeight;
+        if (top >= _height)
+        {
+            std::fill_n(row, _blockColumns, 0);
+            continue;
+        }
+
+        nextOpenRects.clear();
+        for (uint32_t x = 0; x < _blockColumns; x++)
+        {
+            if (row[x] == 0)
+                continue;
+
+            const uint32_t startX = x;
+            while (x < _blockColumns && row[x] != 0)
+            {
+                row[x] = 0;
+                x++;
+            }
+
+            const uint32_t left = startX * blockWidth;
+            const uint32_t right = std::min(x * blockWidth, _width);
+            const uint32_t height = std::min(blockHeight, _height - top);
+            if (left >= right)
+                continue;
+
+            auto it = std::find_if(openRects.begin(), openRects.end(), [&](size_t index) {
+                return rects[index].X == left && rects[index].Width == right - left;
+            });
+            if (it != openRects.end())
+            {
+                rects[*it].Height += height;
+                nextOpenRects.push_back(*it);
+            }
+            else
+            {
+                nextOpenRects.push_back(rects.size());
+                rects.push_back({ left, top, right - left, height });
+            }
+        }
+        std::swap(openRects, nextOpenRects);
+    }
 }
 
 #ifdef __WARN_SUGGEST_FINAL_METHODS__
@@ -163,6 +364,10 @@ void X8DrawingEngine::Invalidate(int32_t left, int32_t top, int32_t right, int32
     if (top >= bottom)
         return;
 
+    // Overlays such as the picked up peep are drawn before they invalidate their area, so it has to be presented now as
+    // well as when the blocks are redrawn.
+    _presentGrid.Invalidate(left, top, right, bottom);
+
     right--;
     bottom--;
 
@@ -194,8 +399,14 @@ void X8DrawingEngine::BeginDraw()
             GfxInvalidateScreen();
             _lastLightFXenabled = Config::Get().general.EnableLightFx;
         }
+        _weatherDrawer.InvalidateDrawnArea(_presentGrid);
         _weatherDrawer.Restore(_bitsDPI);
     }
+    else
+    {
+        // The intro draws straight to the buffer without invalidating anything.
+        _presentGrid.InvalidateAll();
+    }
 }
 
 void X8DrawingEngine::EndDraw()
@@ -216,6 +427,7 @@ void X8DrawingEngine::PaintWindows()
 void X8DrawingEngine::PaintWeather()
 {
     DrawWeather(_bitsDPI, &_weatherDrawer);
+    _weatherDrawer.InvalidateDrawnArea(_presentGrid);
 }
 
 void X8DrawingEngine::CopyRect(int32_t x, int32_t y, int32_t width, int32_t height, int32_t dx, int32_t dy)
@@ -256,6 +468,8 @@ void X8DrawingEngine::CopyRect(int32_t x, int32_t y, int32_t width, int32_t heig
         to += stride;
         from += stride;
     }
+
+    _presentGrid.Invalidate(x, y, x + width, y + height);
 }
 
 std::string X8DrawingEngine::Screenshot()
@@ -361,6 +575,8 @@ void X8DrawingEngine::ConfigureDirtyGrid()
 
     delete[] _dirtyGrid.Blocks;
     _dirtyGrid.Blocks = new uint8_t[_dirtyGrid.BlockColumns * _dirtyGrid.BlockRows];
+
+    _presentGrid.Configure(_width, _height, _dirtyGrid.BlockShiftX, _dirtyGrid.BlockShiftY);
 }
 
 void X8DrawingEngine::DrawAllDirtyBlocks()
@@ -450,6 +666,7 @@ void X8DrawingEngine::DrawDirtyBlocks(uint32_t x, uint32_t y, uint32_t columns,
     // Draw region
     OnDrawDirtyBlock(x, y, columns, rows);
     WindowDrawAll(_bitsDPI, left, top, right, bottom);
+    _presentGrid.Invalidate(left, top, right, bottom);
 }
 
 #ifdef __WARN_SUGGEST_FINAL_METHODS__
@@ -743,7 +960,7 @@ void X8DrawingContext::DrawGlyph(DrawPixelInfo& dpi, const ImageId image, int32_
 #ifndef NO_TTF
 template<bool TUseHinting>
 static void DrawTTFBitmapInternal(
-    DrawPixelInfo& dpi, uint8_t colour, TTFSurface* surface, int32_t x, int32_t y, uint8_t hintingThreshold)
+    DrawPixelInfo& dpi, uint8_t colour, const TTFSurface* surface, int32_t x, int32_t y, uint8_t hintingThreshold)
 {
     assert(dpi.zoom_level == ZoomLevel{ 0 });
     const int32_t surfaceWidth = surface->w;
@@ -813,7 +1030,7 @@ static void DrawTTFBitmapInternal(
 #endif // NO_TTF
 
 void X8DrawingContext::DrawTTFBitmap(
-    DrawPixelInfo& dpi, TextDrawInfo* info, TTFSurface* surface, int32_t x, int32_t y, uint8_t hintingThreshold)
+    DrawPixelInfo& dpi, TextDrawInfo* info, const TTFSurface* surface, int32_t x, int32_t y, uint8_t hintingThreshold)
 {
 #ifndef NO_TTF
     const uint8_t fgColor = info->palette[1];
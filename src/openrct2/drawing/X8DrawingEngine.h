@@ -12,7 +12,10 @@
 #include "IDrawingContext.h"
 #include "IDrawingEngine.h"
 
+#include <array>
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 namespace OpenRCT2
 {
@@ -36,6 +39,45 @@ namespace OpenRCT2
             uint8_t* Blocks;
         };
 
+        struct PresentRect
+        {
+            uint32_t X;
+            uint32_t Y;
+            uint32_t Width;
+            uint32_t Height;
+        };
+
+        /**
+         * Tracks which blocks of the 8-bit buffer changed since it was last presented. Engines that convert the buffer
+         * to another format use it to only convert and upload the parts that changed.
+         */
+        class PresentDirtyGrid
+        {
+        private:
+            uint32_t _width{};
+            uint32_t _height{};
+            uint32_t _blockShiftX{};
+            uint32_t _blockShiftY{};
+            uint32_t _blockColumns{};
+            uint32_t _blockRows{};
+            std::vector<uint8_t> _blocks;
+            bool _all = true;
+
+        public:
+            void Configure(uint32_t width, uint32_t height, uint32_t blockShiftX, uint32_t blockShiftY);
+
+            // Marks the pixels from left, top up to (but not including) right, bottom as changed.
+            void Invalidate(int32_t left, int32_t top, int32_t right, int32_t bottom);
+            void InvalidateAll();
+
+            // Marks the blocks of bits that contain any of the given palette entries as changed, for when their colour
+            // changed but the indices did not.
+            void InvalidatePaletteEntries(const uint8_t* bits, uint32_t pitch, const std::array<bool, 256>& entries);
+
+            // Collects the changed blocks as rectangles clipped to the buffer, then marks everything as presented.
+            void TakeRects(std::vector<PresentRect>& rects);
+        };
+
         class X8WeatherDrawer final : public IWeatherDrawer
         {
         private:
@@ -51,6 +93,12 @@ namespace OpenRCT2
             uint32_t _weatherPixelsCount = 0;
             WeatherPixel* _weatherPixels = nullptr;
 
+            // Bounds of the areas drawn since the last restore.
+            int32_t _drawnLeft = INT32_MAX;
+            int32_t _drawnTop = INT32_MAX;
+            int32_t _drawnRight = INT32_MIN;
+            int32_t _drawnBottom = INT32_MIN;
+
         public:
             X8WeatherDrawer();
             ~X8WeatherDrawer();
@@ -58,6 +106,7 @@ namespace OpenRCT2
                 DrawPixelInfo& dpi, int32_t x, int32_t y, int32_t width, int32_t height, int32_t xStart, int32_t yStart,
                 const uint8_t* weatherpattern) override;
             void Restore(DrawPixelInfo& dpi);
+            void InvalidateDrawnArea(PresentDirtyGrid& grid) const;
         };
 
 #ifdef __WARN_SUGGEST_FINAL_TYPES__
@@ -74,6 +123,7 @@ namespace OpenRCT2
             uint8_t* _bits = nullptr;
 
             DirtyGrid _dirtyGrid = {};
+            PresentDirtyGrid _presentGrid;
 
             DrawPixelInfo _bitsDPI = {};
 
@@ -147,7 +197,7 @@ namespace OpenRCT2
             void DrawGlyph(
                 DrawPixelInfo& dpi, const ImageId image, int32_t x, int32_t y, const PaletteMap& paletteMap) override;
             void DrawTTFBitmap(
-                DrawPixelInfo& dpi, TextDrawInfo* info, TTFSurface* surface, int32_t x, int32_t y,
+                DrawPixelInfo& dpi, TextDrawInfo* info, const TTFSurface* surface, int32_t x, int32_t y,
                 uint8_t hintingThreshold) override;
         };
     } // namespace Drawing
@@ -9,6 +9,7 @@
 
 #include "EntityBase.h"
 
+#include "../OpenRCT2.h"
 #include "../core/DataSerialiser.h"
 #include "../interface/Viewport.h"
 
@@ -23,7 +24,7 @@ bool EntityBase::Is<EntityBase>() const
 
 void EntityBase::Invalidate()
 {
-    if (x == kLocationNull)
+    if (x == kLocationNull || gOpenRCT2Headless)
         return;
 
     ZoomLevel maxZoom{ 0 };
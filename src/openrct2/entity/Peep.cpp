@@ -737,10 +737,20 @@ void PeepEntityRemove(Peep* peep)
 
         News::DisableNewsItems(News::ItemType::Peep, staff->Id.ToUnderlying());
     }
+    const auto peepId = peep->Id;
     EntityRemove(peep);
 
-    auto intent = Intent(wasGuest ? INTENT_ACTION_REFRESH_GUEST_LIST : INTENT_ACTION_REFRESH_STAFF_LIST);
-    ContextBroadcastIntent(&intent);
+    if (wasGuest)
+    {
+        auto intent = Intent(INTENT_ACTION_REMOVE_GUEST_NAME);
+        intent.PutExtra(INTENT_EXTRA_PEEP, peepId);
+        ContextBroadcastIntent(&intent);
+    }
+    else
+    {
+        auto intent = Intent(INTENT_ACTION_REFRESH_STAFF_LIST);
+        ContextBroadcastIntent(&intent);
+    }
 }
 
 /**
@@ -2708,7 +2718,7 @@ void PeepUpdateNames()
     else
         gameState.Park.Flags &= ~PARK_FLAGS_SHOW_REAL_STAFF_NAMES;
 
-    auto intent = Intent(INTENT_ACTION_REFRESH_GUEST_LIST);
+    auto intent = Intent(INTENT_ACTION_INVALIDATE_GUEST_NAMES);
     ContextBroadcastIntent(&intent);
     GfxInvalidateScreen();
 }
@@ -13,6 +13,7 @@
 #include "../config/Config.h"
 #include "../core/EnumUtils.hpp"
 #include "../core/String.hpp"
+#include "../drawing/Drawing.h"
 #include "../drawing/TTF.h"
 #include "../localisation/Language.h"
 #include "../localisation/LocalisationService.h"
@@ -153,6 +154,8 @@ static bool LoadCustomConfigFont(LocalisationService& localisationService)
 
 void TryLoadFonts(LocalisationService& localisationService)
 {
+    GfxInvalidateTextLayoutCache();
+
 #ifndef NO_TTF
     auto currentLanguage = localisationService.GetCurrentLanguage();
     TTFontFamily const* fontFamily = LanguagesDescriptors[currentLanguage].font_family;
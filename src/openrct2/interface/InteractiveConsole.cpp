@@ -62,6 +62,7 @@
 #include "../ride/RideData.h"
 #include "../ride/RideManager.hpp"
 #include "../ride/Vehicle.h"
+#include "../scripting/ScriptEngine.h"
 #include "../ui/WindowManager.h"
 #include "../util/Util.h"
 #include "../windows/Intent.h"
@@ -1742,6 +1743,52 @@ static void ConsoleCommandProfilerStop([[maybe_unused]] InteractiveConsole& cons
     }
 }
 
+#ifdef ENABLE_SCRIPTING
+static void ConsoleCommandPluginStats(InteractiveConsole& console, const arguments_t& argv)
+{
+    auto& scriptEngine = GetContext()->GetScriptEngine();
+    if (argv.size() >= 1 && argv[0] == "reset")
+    {
+        for (const auto& plugin : scriptEngine.GetPlugins())
+        {
+            plugin->ResetCallStats();
+        }
+        console.WriteLine("Plug-in stats reset");
+        return;
+    }
+
+    for (const auto& plugin : scriptEngine.GetPlugins())
+    {
+        console.WriteLine(plugin->GetMetadata().Name);
+        for (const auto& [name, stats] : plugin->GetCallStats())
+        {
+            console.WriteFormatLine(
+                "    %-28s calls: %u, deferred: %u, total: %.2f ms, max: %.2f ms", name.c_str(), stats.CallCount,
+                stats.DeferredCount, stats.TotalTime / 1000.0, stats.MaxTime / 1000.0);
+        }
+    }
+}
+#endif
+
+#ifndef NO_TTF
+static void ConsoleCommandTTFStats(InteractiveConsole& console, const arguments_t& argv)
+{
+    if (argv.size() >= 1 && argv[0] == "reset")
+    {
+        TTFResetGlyphCacheStats();
+        console.WriteLine("TrueType glyph cache stats reset");
+        return;
+    }
+
+    const auto stats = TTFGetGlyphCacheStats();
+    const auto hits = stats.Lookups - std::min(stats.Misses, stats.Lookups);
+    console.WriteFormatLine(
+        "Glyphs cached: %zu, lookups: %llu, hits: %llu, misses: %llu", stats.Glyphs,
+        static_cast<unsigned long long>(stats.Lookups), static_cast<unsigned long long>(hits),
+        static_cast<unsigned long long>(stats.Misses));
+}
+#endif
+
 static void ConsoleSpawnBalloon(InteractiveConsole& console, const arguments_t& argv)
 {
     if (argv.size() < 3)
@@ -1869,6 +1916,14 @@ static constexpr ConsoleCommand console_command_table[] = {
     { "profiler_stop", ConsoleCommandProfilerStop, "Stops the profiler.", "profiler_stop [<output file>]" },
     { "profiler_exportcsv", ConsoleCommandProfilerExportCSV, "Exports the current profiler data.",
       "profiler_exportcsv <output file>" },
+#ifdef ENABLE_SCRIPTING
+    { "plugin_stats", ConsoleCommandPluginStats, "Shows the time spent in each plug-in's hooks and intervals.",
+      "plugin_stats [reset]" },
+#endif
+#ifndef NO_TTF
+    { "ttf_stats", ConsoleCommandTTFStats, "Shows how often TrueType glyphs were found in the glyph cache.",
+      "ttf_stats [reset]" },
+#endif
 };
 
 static void ConsoleCommandWindows(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
@@ -24,9 +24,11 @@
 #include "../core/Imaging.h"
 #include "../core/Path.hpp"
 #include "../core/String.hpp"
+#include "../core/Timer.hpp"
 #include "../drawing/Drawing.h"
 #include "../drawing/X8DrawingEngine.h"
 #include "../localisation/Formatter.h"
+#include "../paint/PaintTileCache.h"
 #include "../paint/Painter.h"
 #include "../platform/Platform.h"
 #include "../world/Climate.h"
@@ -35,9 +37,11 @@
 #include "../world/tile_element/SurfaceElement.h"
 #include "Viewport.h"
 
+#include <array>
 #include <cctype>
 #include <chrono>
 #include <cstdlib>
+#include <future>
 #include <memory>
 #include <optional>
 #include <string>
@@ -52,10 +56,12 @@ extern uint8_t gClipHeight;
 
 uint8_t gScreenshotCountdown = 0;
 
+// Viewport captures are drawn and written in two alternating horizontal strips of together roughly this size, so giant
+// screenshots never need the whole image in memory.
+static constexpr size_t kScreenshotStripSize = 32 * 1024 * 1024;
+
 static bool WriteDpiToFile(std::string_view path, const DrawPixelInfo& dpi, const GamePalette& palette)
 {
-    auto const pixels8 = dpi.bits;
-    auto const pixelsLen = dpi.LineStride() * dpi.height;
     try
     {
         Image image;
@@ -64,8 +70,9 @@ static bool WriteDpiToFile(std::string_view path, const DrawPixelInfo& dpi, cons
         image.Depth = 8;
         image.Stride = dpi.LineStride();
         image.Palette = palette;
-        image.Pixels = std::vector<uint8_t>(pixels8, pixels8 + pixelsLen);
-        Imaging::WriteToFile(path, image, IMAGE_FORMAT::PNG);
+        Imaging::WriteToFile(
+            path, image, [&dpi](uint32_t y) -> const uint8_t* { return dpi.bits + (y * dpi.LineStride()); },
+            IMAGE_FORMAT::PNG);
         return true;
     }
     catch (const std::exception& e)
@@ -227,34 +234,6 @@ static int32_t GetTallestVisibleTileTop(
     return minViewY - 64;
 }
 
-static DrawPixelInfo CreateDPI(const Viewport& viewport)
-{
-    DrawPixelInfo dpi;
-    dpi.width = viewport.width;
-    dpi.height = viewport.height;
-    dpi.bits = new (std::nothrow) uint8_t[dpi.width * dpi.height];
-    if (dpi.bits == nullptr)
-    {
-        throw std::runtime_error("Giant screenshot failed, unable to allocate memory for image.");
-    }
-
-    if (viewport.flags & VIEWPORT_FLAG_TRANSPARENT_BACKGROUND)
-    {
-        std::memset(dpi.bits, PALETTE_INDEX_0, static_cast<size_t>(dpi.width) * dpi.height);
-    }
-
-    return dpi;
-}
-
-static void ReleaseDPI(DrawPixelInfo& dpi)
-{
-    if (dpi.bits != nullptr)
-        delete[] dpi.bits;
-    dpi.bits = nullptr;
-    dpi.width = 0;
-    dpi.height = 0;
-}
-
 static Viewport GetGiantViewport(int32_t rotation, ZoomLevel zoom)
 {
     auto& gameState = GetGameState();
@@ -305,24 +284,92 @@ static Viewport GetGiantViewport(int32_t rotation, ZoomLevel zoom)
     return viewport;
 }
 
-static void RenderViewport(IDrawingEngine* drawingEngine, const Viewport& viewport, DrawPixelInfo& dpi)
+static void RenderViewport(IDrawingEngine& drawingEngine, const Viewport& viewport, DrawPixelInfo& dpi)
 {
     // Ensure sprites appear regardless of rotation
     ResetAllSpriteQuadrantPlacements();
 
-    std::unique_ptr<X8DrawingEngine> tempDrawingEngine;
-    if (drawingEngine == nullptr)
+    dpi.DrawingEngine = &drawingEngine;
+    ViewportRender(dpi, &viewport);
+}
+
+/**
+ * Paints the viewport once and draws it strip by strip as the image writer asks for rows, so only two strips are ever
+ * held in memory. The next strip is drawn while the writer encodes the current one. The paint structs are sorted over
+ * the whole viewport, so the image is the same as a single full render.
+ */
+static bool WriteViewportToFile(std::string_view path, const Viewport& viewport, const GamePalette& palette)
+{
+    try
     {
-        tempDrawingEngine = std::make_unique<X8DrawingEngine>(GetContext()->GetUiContext());
-        drawingEngine = tempDrawingEngine.get();
+        const auto width = static_cast<size_t>(std::max(viewport.width, 1));
+        const auto stripHeight = std::clamp<int32_t>(
+            static_cast<int32_t>(kScreenshotStripSize / 2 / width), 1, std::max(viewport.height, 1));
+        const auto stripCount = (viewport.height + stripHeight - 1) / stripHeight;
+        std::array<std::vector<uint8_t>, 2> strips;
+        for (auto& strip : strips)
+        {
+            strip.resize(width * stripHeight);
+        }
+
+        // Ensure sprites appear regardless of rotation
+        ResetAllSpriteQuadrantPlacements();
+        X8DrawingEngine drawingEngine(GetContext()->GetUiContext());
+        ViewportStripPainter painter(viewport, drawingEngine);
+
+        auto drawStrip = [&](int32_t index) {
+            auto& strip = strips[index % 2];
+            if (viewport.flags & VIEWPORT_FLAG_TRANSPARENT_BACKGROUND)
+            {
+                std::memset(strip.data(), PALETTE_INDEX_0, strip.size());
+            }
+
+            DrawPixelInfo dpi{};
+            dpi.DrawingEngine = &drawingEngine;
+            dpi.bits = strip.data();
+            dpi.width = viewport.width;
+            dpi.y = index * stripHeight;
+            dpi.height = std::min(stripHeight, viewport.height - dpi.y);
+            painter.Draw(dpi);
+        };
+
+        // Declared after everything the drawing uses, so an unfinished strip is waited for before that is destroyed.
+        int32_t currentStrip = -1;
+        std::future<void> nextStrip = std::async(std::launch::async, drawStrip, 0);
+
+        Image image;
+        image.Width = viewport.width;
+        image.Height = viewport.height;
+        image.Depth = 8;
+        image.Stride = viewport.width;
+        image.Palette = palette;
+        Imaging::WriteToFile(
+            path, image,
+            [&](uint32_t y) -> const uint8_t* {
+                const auto index = static_cast<int32_t>(y) / stripHeight;
+                if (index != currentStrip)
+                {
+                    nextStrip.get();
+                    currentStrip = index;
+                    if (index + 1 < stripCount)
+                    {
+                        nextStrip = std::async(std::launch::async, drawStrip, index + 1);
+                    }
+                }
+                return strips[index % 2].data() + ((y - index * stripHeight) * width);
+            },
+            IMAGE_FORMAT::PNG);
+        return true;
+    }
+    catch (const std::exception& e)
+    {
+        LOG_ERROR("Unable to write png: %s", e.what());
+        return false;
     }
-    dpi.DrawingEngine = drawingEngine;
-    ViewportRender(dpi, &viewport);
 }
 
 void ScreenshotGiant()
 {
-    DrawPixelInfo dpi{};
     try
     {
         auto path = ScreenshotGetNextPath();
@@ -350,10 +397,10 @@ void ScreenshotGiant()
             viewport.flags |= VIEWPORT_FLAG_TRANSPARENT_BACKGROUND;
         }
 
-        dpi = CreateDPI(viewport);
-
-        RenderViewport(nullptr, viewport, dpi);
-        WriteDpiToFile(path.value(), dpi, gPalette);
+        if (!WriteViewportToFile(path.value(), viewport, gPalette))
+        {
+            throw std::runtime_error("Giant screenshot failed, unable to write image.");
+        }
 
         // Show user that screenshot saved successfully
         const auto filename = Path::GetFileName(path.value());
@@ -367,8 +414,6 @@ void ScreenshotGiant()
         LOG_ERROR("%s", e.what());
         ContextShowError(STR_SCREENSHOT_FAILED, kStringIdNone, {}, true);
     }
-
-    ReleaseDPI(dpi);
 }
 
 static void ApplyOptions(const ScreenshotOptions* options, Viewport& viewport)
@@ -441,7 +486,6 @@ int32_t CommandLineForScreenshot(const char** argv, int32_t argc, ScreenshotOpti
     }
 
     int32_t exitCode = 1;
-    DrawPixelInfo dpi;
     try
     {
         bool customLocation = false;
@@ -541,17 +585,279 @@ int32_t CommandLineForScreenshot(const char** argv, int32_t argc, ScreenshotOpti
 
         ApplyOptions(options, viewport);
 
-        dpi = CreateDPI(viewport);
+        if (!WriteViewportToFile(outputPath, viewport, gPalette))
+        {
+            exitCode = -1;
+        }
+    }
+    catch (const std::exception& e)
+    {
+        std::printf("%s\n", e.what());
+        exitCode = -1;
+    }
+
+    DrawingEngineDispose();
+
+    return exitCode;
+}
+
+struct BenchGfxView
+{
+    const char* Name;
+    uint32_t Flags;
+};
+
+// clang-format off
+static constexpr BenchGfxView kBenchGfxViews[] = {
+    { "default",            VIEWPORT_FLAG_NONE },
+    { "underground",        VIEWPORT_FLAG_UNDERGROUND_INSIDE },
+    { "see-through",        VIEWPORT_FLAG_HIDE_RIDES | VIEWPORT_FLAG_HIDE_VEHICLES | VIEWPORT_FLAG_HIDE_VEGETATION
+                            | VIEWPORT_FLAG_HIDE_SCENERY | VIEWPORT_FLAG_HIDE_PATHS | VIEWPORT_FLAG_HIDE_SUPPORTS },
+    { "invisible-supports", VIEWPORT_FLAG_HIDE_SUPPORTS | VIEWPORT_FLAG_INVISIBLE_SUPPORTS },
+};
+// clang-format on
+
+static Viewport GetBenchGfxViewport(int32_t width, int32_t height, ZoomLevel zoom, uint8_t rotation, uint32_t flags)
+{
+    const auto& mapSize = GetGameState().MapSize;
+    const CoordsXY centre = { (mapSize.x / 2) * kCoordsXYStep + 16, (mapSize.y / 2) * kCoordsXYStep + 16 };
+    const auto centre2d = Translate3DTo2DWithZ(rotation, { centre, TileElementHeight(centre) });
+
+    Viewport viewport{};
+    viewport.width = width;
+    viewport.height = height;
+    viewport.zoom = zoom;
+    viewport.rotation = rotation;
+    viewport.flags = flags;
+    viewport.viewPos = { centre2d.x - (viewport.ViewWidth() / 2), centre2d.y - (viewport.ViewHeight() / 2) };
+    return viewport;
+}
+
+static uint64_t HashRenderedView(const std::vector<uint8_t>& pixels)
+{
+    uint64_t hash = 0xCBF29CE484222325ull;
+    for (auto pixel : pixels)
+    {
+        hash = (hash ^ pixel) * 0x100000001B3ull;
+    }
+    return hash;
+}
+
+struct BenchPresentTimings
+{
+    double Full;
+    double Animated;
+    double AnimatedArea;
+};
+
+static uint32_t GetBenchPresentColour(const PaletteBGRA& colour)
+{
+    return (colour.Red << 16) | (colour.Green << 8) | colour.Blue;
+}
+
+/**
+ * Compares converting a whole view to 32-bit colour with converting only the parts using palette entries that changed,
+ * which is what the display engines do each frame the water animates.
+ */
+static BenchPresentTimings MeasureBenchPresent(
+    const std::vector<uint8_t>& pixels, int32_t width, int32_t height, int32_t iterations)
+{
+    BenchPresentTimings result{};
+    std::vector<uint32_t> frame(pixels.size());
+    uint32_t palette[256];
+    for (int32_t i = 0; i < 256; i++)
+    {
+        palette[i] = GetBenchPresentColour(gPalette[i]);
+    }
+
+    Timer timer;
+    for (int32_t i = 0; i < iterations; i++)
+    {
+        PaletteLookupFn(width, height, pixels.data(), frame.data(), 0, 0, palette);
+    }
+    result.Full = timer.GetElapsedTime().count() * 1000.0 / iterations;
+
+    PresentDirtyGrid grid;
+    grid.Configure(width, height, 7, 5);
+    std::vector<PresentRect> rects;
+    grid.TakeRects(rects);
+
+    double elapsed = 0;
+    uint64_t area = 0;
+    for (int32_t i = 0; i < iterations; i++)
+    {
+        // One frame at 60 fps.
+        gPaletteEffectFrame += 16;
+        UpdatePaletteEffects();
 
-        RenderViewport(nullptr, viewport, dpi);
-        WriteDpiToFile(outputPath, dpi, gPalette);
+        Timer frameTimer;
+        std::array<bool, 256> changed{};
+        for (int32_t j = 0; j < 256; j++)
+        {
+            const auto colour = GetBenchPresentColour(gPalette[j]);
+            changed[j] = colour != palette[j];
+            palette[j] = colour;
+        }
+        grid.InvalidatePaletteEntries(pixels.data(), width, changed);
+        grid.TakeRects(rects);
+        for (const auto& rect : rects)
+        {
+            const auto offset = rect.Y * width + rect.X;
+            const auto wrap = width - static_cast<int32_t>(rect.Width);
+            PaletteLookupFn(rect.Width, rect.Height, &pixels[offset], &frame[offset], wrap, wrap, palette);
+            area += static_cast<uint64_t>(rect.Width) * rect.Height;
+        }
+        elapsed += frameTimer.GetElapsedTime().count();
+    }
+    result.Animated = elapsed * 1000.0 / iterations;
+    result.AnimatedArea = area * 100.0 / (static_cast<double>(pixels.size()) * iterations);
+    return result;
+}
+
+/**
+ * Renders the loaded park around the centre of the map for every zoom level, rotation and a few view flag combinations
+ * and prints how long each phase of painting took, so changes to the paint pipeline can be compared.
+ */
+int32_t CommandLineForBenchGfx(const char** argv, int32_t argc, const BenchGfxOptions* options)
+{
+    // Don't include options in the count (they have been handled by CommandLine::ParseOptions already)
+    for (int32_t i = 0; i < argc; i++)
+    {
+        if (argv[i][0] == '-')
+        {
+            argc = i;
+            break;
+        }
+    }
+
+    if (argc != 1 && argc != 3)
+    {
+        std::printf(
+            "Usage: openrct2 benchgfx <file> [<width> <height>] [--iterations <count>] [--hash] [--present] "
+            "[--no-tile-cache]\n");
+        return -1;
+    }
+
+    const int32_t width = argc == 3 ? std::atoi(argv[1]) : 1920;
+    const int32_t height = argc == 3 ? std::atoi(argv[2]) : 1080;
+    const int32_t iterations = std::max(options->Iterations, 1);
+    if (width <= 0 || height <= 0)
+    {
+        std::printf("Invalid resolution %dx%d.\n", width, height);
+        return -1;
+    }
+
+    int32_t exitCode = 1;
+    try
+    {
+        gOpenRCT2Headless = true;
+        auto context = CreateContext();
+        if (!context->Initialise())
+        {
+            throw std::runtime_error("Failed to initialize context.");
+        }
+
+        DrawingEngineInit();
+
+        if (!context->LoadParkFromFile(argv[0]))
+        {
+            throw std::runtime_error("Failed to load park.");
+        }
+
+        gScreenFlags = SCREEN_FLAGS_PLAYING;
+        PaintTileCacheSetEnabled(!options->NoTileCache);
+
+        std::vector<uint8_t> pixels(static_cast<size_t>(width) * height);
+        X8DrawingEngine drawingEngine(context->GetUiContext());
+        DrawPixelInfo dpi{};
+        dpi.bits = pixels.data();
+        dpi.width = width;
+        dpi.height = height;
+
+        Console::WriteLine(
+            "Rendering %dx%d, %d frames per view, multithreading %s, tile cache %s", width, height, iterations,
+            Config::Get().general.MultiThreading ? "on" : "off", options->NoTileCache ? "off" : "on");
+        Console::WriteLine(
+            "%-18s %4s %3s %10s %10s %10s %10s%s", "view", "zoom", "rot", "total ms", "generate", "arrange", "draw",
+            options->Hash ? "  hash" : "");
+
+        ViewportPaintTimings totalTimings{};
+        PaintTileCacheStats totalTiles{};
+        double totalTime = 0;
+        PaintTileCacheSetStatsEnabled(true);
+        for (const auto& view : kBenchGfxViews)
+        {
+            for (auto zoom = ZoomLevel::min(); zoom <= ZoomLevel::max(); zoom++)
+            {
+                for (uint8_t rotation = 0; rotation < 4; rotation++)
+                {
+                    const auto viewport = GetBenchGfxViewport(width, height, zoom, rotation, view.Flags);
+
+                    // The first frame loads sprites and fills caches, it is not part of the timings.
+                    std::fill(pixels.begin(), pixels.end(), PALETTE_INDEX_0);
+                    RenderViewport(drawingEngine, viewport, dpi);
+                    PaintTileCacheTakeStats();
+
+                    ViewportPaintTimings timings{};
+                    ViewportSetPaintTimings(&timings);
+                    Timer timer;
+                    for (int32_t i = 0; i < iterations; i++)
+                    {
+                        RenderViewport(drawingEngine, viewport, dpi);
+                    }
+                    const double elapsed = timer.GetElapsedTime().count();
+                    ViewportSetPaintTimings(nullptr);
+                    const auto tiles = PaintTileCacheTakeStats();
+                    // Hashed after the timed frames, which replay the tiles cached by the first one.
+                    const auto hash = options->Hash ? HashRenderedView(pixels) : 0;
+
+                    Console::WriteLine(
+                        "%-18s %4d %3d %10.3f %10.3f %10.3f %10.3f", view.Name, static_cast<int8_t>(zoom), rotation,
+                        elapsed * 1000.0 / iterations, timings.Generate * 1000.0 / iterations,
+                        timings.Arrange * 1000.0 / iterations, timings.Draw * 1000.0 / iterations);
+                    if (options->Hash)
+                    {
+                        Console::WriteLine("%-18s %016llx", "", static_cast<unsigned long long>(hash));
+                    }
+                    if (options->Present)
+                    {
+                        const auto present = MeasureBenchPresent(pixels, width, height, iterations);
+                        Console::WriteLine(
+                            "%-18s present: full %.3f ms, animated palette %.3f ms (%.1f%% of the view)", "", present.Full,
+                            present.Animated, present.AnimatedArea);
+                    }
+
+                    totalTime += elapsed;
+                    totalTimings.Generate += timings.Generate;
+                    totalTimings.Arrange += timings.Arrange;
+                    totalTimings.Draw += timings.Draw;
+                    totalTiles.Hits += tiles.Hits;
+                    totalTiles.Misses += tiles.Misses;
+                    totalTiles.Bypassed += tiles.Bypassed;
+                }
+            }
+        }
+
+        Console::WriteLine(
+            "Total: %.3f s (generate %.3f s, arrange %.3f s, draw %.3f s)", totalTime, totalTimings.Generate,
+            totalTimings.Arrange, totalTimings.Draw);
+        PaintTileCacheSetStatsEnabled(false);
+        if (const auto numTiles = totalTiles.Hits + totalTiles.Misses + totalTiles.Bypassed; numTiles != 0)
+        {
+            Console::WriteLine(
+                "Tiles: %.1f%% replayed, %.1f%% recorded, %.1f%% painted without the cache", totalTiles.Hits * 100.0 / numTiles,
+                totalTiles.Misses * 100.0 / numTiles, totalTiles.Bypassed * 100.0 / numTiles);
+        }
+        if (const auto peakMemory = Platform::GetPeakMemoryUsage(); peakMemory != 0)
+        {
+            Console::WriteLine("Peak memory: %.1f MiB", peakMemory / (1024.0 * 1024.0));
+        }
     }
     catch (const std::exception& e)
     {
         std::printf("%s\n", e.what());
         exitCode = -1;
     }
-    ReleaseDPI(dpi);
 
     DrawingEngineDispose();
 
@@ -634,8 +940,5 @@ void CaptureImage(const CaptureOptions& options)
     }
 
     auto outputPath = ResolveFilenameForCapture(options.Filename);
-    auto dpi = CreateDPI(viewport);
-    RenderViewport(nullptr, viewport, dpi);
-    WriteDpiToFile(outputPath, dpi, gPalette);
-    ReleaseDPI(dpi);
+    WriteViewportToFile(outputPath, viewport, gPalette);
 }
@@ -35,6 +35,14 @@ struct ScreenshotOptions
     bool transparent = false;
 };
 
+struct BenchGfxOptions
+{
+    int32_t Iterations = 10;
+    bool Hash = false;
+    bool Present = false;
+    bool NoTileCache = false;
+};
+
 struct CaptureView
 {
     int32_t Width{};
@@ -57,5 +65,6 @@ std::string ScreenshotDumpPNG(DrawPixelInfo& dpi);
 
 void ScreenshotGiant();
 int32_t CommandLineForScreenshot(const char** argv, int32_t argc, ScreenshotOptions* options);
+int32_t CommandLineForBenchGfx(const char** argv, int32_t argc, const BenchGfxOptions* options);
 
 void CaptureImage(const CaptureOptions& options);
@@ -19,6 +19,7 @@
 #include "../core/Guard.hpp"
 #include "../core/JobPool.h"
 #include "../core/Numerics.hpp"
+#include "../core/Timer.hpp"
 #include "../drawing/Drawing.h"
 #include "../drawing/IDrawingEngine.h"
 #include "../entity/EntityList.h"
@@ -30,6 +31,7 @@
 #include "../object/SmallSceneryEntry.h"
 #include "../object/WallSceneryEntry.h"
 #include "../paint/Paint.h"
+#include "../paint/PaintTileCache.h"
 #include "../profiling/Profiling.h"
 #include "../ride/Ride.h"
 #include "../ride/RideData.h"
@@ -70,6 +72,8 @@ namespace OpenRCT2
 
     static std::unique_ptr<JobPool> _paintJobs;
     static std::vector<PaintSession*> _paintColumns;
+    static ViewportPaintTimings* _paintTimings;
+    static std::vector<ViewportPaintTimings> _paintColumnTimings;
 
     InteractionInfo::InteractionInfo(const PaintStruct* ps)
         : Loc(ps->MapPos)
@@ -925,18 +929,35 @@ namespace OpenRCT2
         ViewportPaint(viewport, dpi);
     }
 
-    static void ViewportFillColumn(PaintSession& session)
+    void ViewportSetPaintTimings(ViewportPaintTimings* timings)
+    {
+        _paintTimings = timings;
+    }
+
+    static void ViewportFillColumn(PaintSession& session, ViewportPaintTimings* timings)
     {
         PROFILED_FUNCTION();
 
+        if (timings == nullptr)
+        {
+            PaintSessionGenerate(session);
+            PaintSessionArrange(session);
+            return;
+        }
+
+        Timer timer;
         PaintSessionGenerate(session);
+        timings->Generate += timer.GetElapsedTimeAndRestart().count();
         PaintSessionArrange(session);
+        timings->Arrange += timer.GetElapsedTime().count();
     }
 
-    static void ViewportPaintColumn(PaintSession& session)
+    static void ViewportPaintColumn(PaintSession& session, ViewportPaintTimings* timings)
     {
         PROFILED_FUNCTION();
 
+        Timer timer;
+
         if (session.ViewFlags
                 & (VIEWPORT_FLAG_HIDE_VERTICAL | VIEWPORT_FLAG_HIDE_BASE | VIEWPORT_FLAG_UNDERGROUND_INSIDE
                    | VIEWPORT_FLAG_CLIP_VIEW)
@@ -962,6 +983,35 @@ namespace OpenRCT2
         {
             PaintDrawMoneyStructs(session.DPI, session.PSStringHead);
         }
+
+        if (timings != nullptr)
+        {
+            timings->Draw += timer.GetElapsedTime().count();
+        }
+    }
+
+    // Narrows the dpi of a viewport to the column of the given width starting at x.
+    static void ViewportClipToColumn(DrawPixelInfo& columnDpi, int32_t x, int32_t columnWidth)
+    {
+        if (x >= columnDpi.x)
+        {
+            const int32_t leftPitch = x - columnDpi.x;
+            columnDpi.width = columnDpi.width - leftPitch;
+            // The strip painter sorts its columns before it has any pixels to draw into.
+            if (columnDpi.bits != nullptr)
+                columnDpi.bits += leftPitch;
+            columnDpi.pitch += leftPitch;
+            columnDpi.x = x;
+        }
+
+        int32_t paintRight = columnDpi.x + columnDpi.width;
+        if (paintRight >= x + columnWidth)
+        {
+            const int32_t rightPitch = paintRight - x - columnWidth;
+            paintRight -= rightPitch;
+            columnDpi.pitch += rightPitch;
+        }
+        columnDpi.width = paintRight - columnDpi.x;
     }
 
     /**
@@ -997,6 +1047,7 @@ namespace OpenRCT2
         worldDpi.zoom_level = viewport->zoom;
 
         _paintColumns.clear();
+        PaintTileCacheBeginView(viewport->ViewWidth(), viewport->ViewHeight());
 
         bool useMultithreading = Config::Get().general.MultiThreading;
         if (useMultithreading && _paintJobs == nullptr)
@@ -1018,38 +1069,32 @@ namespace OpenRCT2
         const int32_t rightBorder = worldDpi.x + worldDpi.width;
         const int32_t alignedX = floor2(worldDpi.x, columnWidth);
 
+        // Each column gets its own timings so the jobs never write to the same ones, they are summed at the end.
+        _paintColumnTimings.clear();
+        if (_paintTimings != nullptr)
+        {
+            _paintColumnTimings.resize(std::max(0, (rightBorder - alignedX + columnWidth - 1) / columnWidth));
+        }
+        auto getColumnTimings = [](size_t column) -> ViewportPaintTimings* {
+            return column < _paintColumnTimings.size() ? &_paintColumnTimings[column] : nullptr;
+        };
+
         // Generate and sort columns.
         for (int32_t x = alignedX; x < rightBorder; x += columnWidth)
         {
             PaintSession* session = PaintSessionAlloc(worldDpi, viewport->flags, viewport->rotation);
+            auto* timings = getColumnTimings(_paintColumns.size());
             _paintColumns.push_back(session);
 
-            DrawPixelInfo& columnDpi = session->DPI;
-            if (x >= columnDpi.x)
-            {
-                const int32_t leftPitch = x - columnDpi.x;
-                columnDpi.width = columnDpi.width - leftPitch;
-                columnDpi.bits += leftPitch;
-                columnDpi.pitch += leftPitch;
-                columnDpi.x = x;
-            }
-
-            int32_t paintRight = columnDpi.x + columnDpi.width;
-            if (paintRight >= x + columnWidth)
-            {
-                const int32_t rightPitch = paintRight - x - columnWidth;
-                paintRight -= rightPitch;
-                columnDpi.pitch += rightPitch;
-            }
-            columnDpi.width = paintRight - columnDpi.x;
+            ViewportClipToColumn(session->DPI, x, columnWidth);
 
             if (useMultithreading)
             {
-                _paintJobs->AddTask([session]() -> void { ViewportFillColumn(*session); });
+                _paintJobs->AddTask([session, timings]() -> void { ViewportFillColumn(*session, timings); });
             }
             else
             {
-                ViewportFillColumn(*session);
+                ViewportFillColumn(*session, timings);
             }
         }
 
@@ -1059,15 +1104,17 @@ namespace OpenRCT2
         }
 
         // Paint columns.
-        for (auto* session : _paintColumns)
+        for (size_t i = 0; i < _paintColumns.size(); i++)
         {
+            auto* session = _paintColumns[i];
+            auto* timings = getColumnTimings(i);
             if (useParallelDrawing)
             {
-                _paintJobs->AddTask([session]() -> void { ViewportPaintColumn(*session); });
+                _paintJobs->AddTask([session, timings]() -> void { ViewportPaintColumn(*session, timings); });
             }
             else
             {
-                ViewportPaintColumn(*session);
+                ViewportPaintColumn(*session, timings);
             }
         }
         if (useParallelDrawing)
@@ -1075,6 +1122,13 @@ namespace OpenRCT2
             _paintJobs->Join();
         }
 
+        for (const auto& timings : _paintColumnTimings)
+        {
+            _paintTimings->Generate += timings.Generate;
+            _paintTimings->Arrange += timings.Arrange;
+            _paintTimings->Draw += timings.Draw;
+        }
+
         // Release resources.
         for (auto* session : _paintColumns)
         {
@@ -1082,6 +1136,97 @@ namespace OpenRCT2
         }
     }
 
+    // The world dpi for rows top up to top + height of the whole width of the viewport.
+    static DrawPixelInfo ViewportGetRowsDpi(
+        const Viewport& viewport, Drawing::IDrawingEngine& drawingEngine, int32_t top, int32_t height)
+    {
+        DrawPixelInfo dpi;
+        dpi.DrawingEngine = &drawingEngine;
+        dpi.x = viewport.zoom.ApplyInversedTo(viewport.viewPos.x);
+        dpi.y = viewport.zoom.ApplyInversedTo(viewport.viewPos.y) + top;
+        dpi.width = viewport.width;
+        dpi.height = height;
+        dpi.zoom_level = viewport.zoom;
+        return dpi;
+    }
+
+    ViewportStripPainter::ViewportStripPainter(const Viewport& viewport, Drawing::IDrawingEngine& drawingEngine)
+        : _viewport(viewport)
+        , _drawingEngine(drawingEngine)
+    {
+        if (viewport.flags & VIEWPORT_FLAG_RENDERING_INHIBITED)
+            return;
+
+        if (Config::Get().general.MultiThreading)
+        {
+            _jobs = std::make_unique<JobPool>();
+        }
+
+        auto worldDpi = ViewportGetRowsDpi(viewport, drawingEngine, 0, viewport.height);
+        const int32_t columnWidth = worldDpi.zoom_level.ApplyInversedTo(kCoordsXYStep);
+        const int32_t rightBorder = worldDpi.x + worldDpi.width;
+        PaintTileCacheBeginView(viewport.ViewWidth(), viewport.ViewHeight());
+        for (int32_t x = floor2(worldDpi.x, columnWidth); x < rightBorder; x += columnWidth)
+        {
+            PaintSession* session = PaintSessionAlloc(worldDpi, viewport.flags, viewport.rotation);
+            _columns.push_back(session);
+            ViewportClipToColumn(session->DPI, x, columnWidth);
+            if (_jobs != nullptr)
+            {
+                _jobs->AddTask([session]() -> void { ViewportFillColumn(*session, nullptr); });
+            }
+            else
+            {
+                ViewportFillColumn(*session, nullptr);
+            }
+        }
+        if (_jobs != nullptr)
+        {
+            _jobs->Join();
+        }
+    }
+
+    ViewportStripPainter::~ViewportStripPainter()
+    {
+        for (auto* session : _columns)
+        {
+            PaintSessionFree(session);
+        }
+    }
+
+    void ViewportStripPainter::Draw(DrawPixelInfo& dpi)
+    {
+        if (_columns.empty())
+            return;
+
+        auto stripDpi = ViewportGetRowsDpi(_viewport, _drawingEngine, dpi.y - _viewport.pos.y, dpi.height);
+        stripDpi.bits = dpi.bits;
+        stripDpi.pitch = dpi.LineStride() - stripDpi.width;
+
+        const bool useParallelDrawing = _jobs != nullptr && (_drawingEngine.GetFlags() & DEF_PARALLEL_DRAWING);
+        const int32_t columnWidth = stripDpi.zoom_level.ApplyInversedTo(kCoordsXYStep);
+        int32_t x = floor2(stripDpi.x, columnWidth);
+        for (auto* session : _columns)
+        {
+            // Only the dpi changes, the sorted paint structs are drawn again clipped to the new rows.
+            session->DPI = stripDpi;
+            ViewportClipToColumn(session->DPI, x, columnWidth);
+            x += columnWidth;
+            if (useParallelDrawing)
+            {
+                _jobs->AddTask([session]() -> void { ViewportPaintColumn(*session, nullptr); });
+            }
+            else
+            {
+                ViewportPaintColumn(*session, nullptr);
+            }
+        }
+        if (useParallelDrawing)
+        {
+            _jobs->Join();
+        }
+    }
+
     static void ViewportPaintWeatherGloom(DrawPixelInfo& dpi)
     {
         auto paletteId = ClimateGetWeatherGloomPaletteId(GetGameState().ClimateCurrent);
@@ -13,9 +13,11 @@
 #include "Window.h"
 
 #include <limits>
+#include <memory>
 #include <optional>
 #include <vector>
 
+class JobPool;
 struct PaintSession;
 struct PaintStruct;
 struct DrawPixelInfo;
@@ -27,6 +29,11 @@ struct PaintEntry;
 
 namespace OpenRCT2
 {
+    namespace Drawing
+    {
+        struct IDrawingEngine;
+    }
+
     struct WindowBase;
 
     struct Viewport
@@ -166,6 +173,37 @@ namespace OpenRCT2
 
     constexpr int32_t kMaxViewportCount = kWindowLimitMax;
 
+    // Time spent in each phase of painting viewports, in seconds summed over all columns and threads.
+    struct ViewportPaintTimings
+    {
+        double Generate{};
+        double Arrange{};
+        double Draw{};
+    };
+
+    /**
+     * Paints a viewport once and then draws it a range of rows at a time, so the image never has to be held whole. The
+     * paint structs are generated and sorted over the full height of the viewport like ViewportRender does, so each range
+     * of rows comes out the same as those rows of a single render.
+     */
+    class ViewportStripPainter
+    {
+    private:
+        Viewport _viewport;
+        Drawing::IDrawingEngine& _drawingEngine;
+        std::unique_ptr<JobPool> _jobs;
+        std::vector<PaintSession*> _columns;
+
+    public:
+        ViewportStripPainter(const Viewport& viewport, Drawing::IDrawingEngine& drawingEngine);
+        ViewportStripPainter(const ViewportStripPainter&) = delete;
+        ViewportStripPainter& operator=(const ViewportStripPainter&) = delete;
+        ~ViewportStripPainter();
+
+        // Draws the rows dpi.y up to dpi.y + dpi.height of the viewport into dpi, which has to span its full width.
+        void Draw(DrawPixelInfo& dpi);
+    };
+
     /**
      * A reference counter for whether something is forcing the grid lines to show. When the counter
      * is decremented to 0, the grid lines are hidden.
@@ -190,6 +228,8 @@ namespace OpenRCT2
     void ViewportRotateSingle(WindowBase* window, int32_t direction);
     void ViewportRotateAll(int32_t direction);
     void ViewportRender(DrawPixelInfo& dpi, const Viewport* viewport);
+    // Adds the time spent painting viewports to the given timings until it is set back to nullptr.
+    void ViewportSetPaintTimings(ViewportPaintTimings* timings);
 
     CoordsXYZ ViewportAdjustForMapHeight(const ScreenCoordsXY& startCoords, uint8_t rotation);
 
@@ -41,6 +41,7 @@
 
 #include <cassert>
 #include <iterator>
+#include <limits>
 #include <stdexcept>
 
 using namespace OpenRCT2;
@@ -49,7 +50,7 @@ using namespace OpenRCT2;
 // It is used for making sure only compatible builds get connected, even within
 // single OpenRCT2 version.
 
-constexpr uint8_t kNetworkStreamVersion = 0;
+constexpr uint8_t kNetworkStreamVersion = 1;
 
 const std::string kNetworkStreamID = std::string(kOpenRCT2Version) + "-" + std::to_string(kNetworkStreamVersion);
 
@@ -66,11 +67,20 @@ static constexpr uint32_t kChunkSize = 1024 * 63;
 // This limit is per connection, the current value was determined by tests with fuzzing.
 static constexpr uint32_t kMaxPacketsPerUpdate = 100;
 
+// Game action batches larger than this are compressed before being sent.
+static constexpr uint32_t kGameActionBatchCompressionThreshold = 1024;
+static constexpr uint8_t kGameActionBatchFlagCompressed = 1 << 0;
+// Tick, type and length written before each action in a batch.
+static constexpr size_t kGameActionBatchEntryHeaderSize = sizeof(uint32_t) + sizeof(GameCommand) + sizeof(uint32_t);
+// Actions had to fit in a single packet before they were batched, so a serialised action is never larger than this.
+static constexpr size_t kMaxGameActionSize = std::numeric_limits<uint16_t>::max();
+
     #include "../Cheats.h"
     #include "../ParkImporter.h"
     #include "../Version.h"
     #include "../actions/GameAction.h"
     #include "../config/Config.h"
+    #include "../core/Compression.h"
     #include "../core/Console.hpp"
     #include "../core/EnumUtils.hpp"
     #include "../core/FileStream.h"
@@ -125,6 +135,7 @@ NetworkBase::NetworkBase(OpenRCT2::IContext& context)
     client_command_handlers[NetworkCommand::Map] = &NetworkBase::Client_Handle_MAP;
     client_command_handlers[NetworkCommand::Chat] = &NetworkBase::Client_Handle_CHAT;
     client_command_handlers[NetworkCommand::GameAction] = &NetworkBase::Client_Handle_GAME_ACTION;
+    client_command_handlers[NetworkCommand::GameActionBatch] = &NetworkBase::Client_Handle_GAME_ACTION_BATCH;
     client_command_handlers[NetworkCommand::Tick] = &NetworkBase::Client_Handle_TICK;
     client_command_handlers[NetworkCommand::PlayerList] = &NetworkBase::Client_Handle_PLAYERLIST;
     client_command_handlers[NetworkCommand::PlayerInfo] = &NetworkBase::Client_Handle_PLAYERINFO;
@@ -207,6 +218,8 @@ void NetworkBase::Close()
         _serverTickData.clear();
         _pendingPlayerLists.clear();
         _pendingPlayerInfo.clear();
+        _gameActionBatch.Clear();
+        _gameActionBatchCount = 0;
 
     #ifdef ENABLE_SCRIPTING
         auto& scriptEngine = GetContext().GetScriptEngine();
@@ -477,6 +490,8 @@ void NetworkBase::Update()
     switch (GetMode())
     {
         case NETWORK_MODE_SERVER:
+            // Actions executed outside of a tick must reach clients before anything sent in response to their packets.
+            ServerFlushGameActions();
             UpdateServer();
             break;
         case NETWORK_MODE_CLIENT:
@@ -504,6 +519,7 @@ void NetworkBase::Flush()
     }
     else
     {
+        ServerFlushGameActions();
         for (auto& it : client_connection_list)
         {
             it->SendQueuedData();
@@ -513,13 +529,25 @@ void NetworkBase::Flush()
 
 void NetworkBase::UpdateServer()
 {
+    // Find the connections with incoming data in one call instead of attempting a read on every socket.
+    std::vector<ITcpSocket*> sockets;
+    sockets.reserve(client_connection_list.size());
+    for (auto& connection : client_connection_list)
+    {
+        sockets.push_back(connection->Socket.get());
+    }
+    const auto readable = GetReadableSockets(sockets);
+
+    size_t connectionIndex = 0;
     for (auto& connection : client_connection_list)
     {
+        const bool hasData = readable[connectionIndex++];
+
         // This can be called multiple times before the connection is removed.
         if (!connection->IsValid())
             continue;
 
-        if (!ProcessConnection(*connection))
+        if (!ProcessConnection(*connection, hasData))
         {
             connection->Disconnect();
         }
@@ -785,6 +813,8 @@ const char* NetworkBase::FormatChat(NetworkPlayer* fromPlayer, const char* text)
 
 void NetworkBase::SendPacketToClients(const NetworkPacket& packet, bool front, bool gameCmd) const
 {
+    // Serialise once, every connection queues the same buffer.
+    const auto buffer = NetworkConnection::SerialisePacket(packet);
     for (auto& client_connection : client_connection_list)
     {
         if (gameCmd)
@@ -798,7 +828,7 @@ void NetworkBase::SendPacketToClients(const NetworkPacket& packet, bool front, b
                 continue;
             }
         }
-        client_connection->QueuePacket(packet, front);
+        client_connection->QueuePacket(packet, buffer, front);
     }
 }
 
@@ -1466,6 +1496,9 @@ void NetworkBase::ServerSendMap(NetworkConnection* connection)
         objects = objManager.GetPackableObjects();
     }
 
+    // The saved map already includes every executed action, they must not be replayed on top of it.
+    ServerFlushGameActions();
+
     auto header = SaveForNetwork(objects);
     if (header.empty())
     {
@@ -1563,18 +1596,60 @@ void NetworkBase::Client_Send_GAME_ACTION(const GameAction* action)
 
 void NetworkBase::ServerSendGameAction(const GameAction* action)
 {
-    NetworkPacket packet(NetworkCommand::GameAction);
-
     DataSerialiser stream(true);
     action->Serialise(stream);
+    const auto& actionData = stream.GetStream();
+    const auto actionLength = static_cast<uint32_t>(actionData.GetLength());
 
-    packet << GetGameState().CurrentTicks << action->GetType() << stream;
+    // Relayed actions are collected and sent as one packet per tick, see ServerFlushGameActions.
+    if (_gameActionBatch.GetLength() + kGameActionBatchEntryHeaderSize + actionLength > kChunkSize)
+    {
+        ServerFlushGameActions();
+    }
+
+    DataSerialiser batch(true, _gameActionBatch);
+    batch << GetGameState().CurrentTicks << action->GetType() << actionLength;
+    _gameActionBatch.Write(actionData.GetData(), actionLength);
+    _gameActionBatchCount++;
+}
+
+void NetworkBase::ServerFlushGameActions()
+{
+    if (_gameActionBatchCount == 0)
+    {
+        return;
+    }
+
+    NetworkPacket packet(NetworkCommand::GameActionBatch);
+    const auto* data = _gameActionBatch.GetData();
+    const auto length = static_cast<size_t>(_gameActionBatch.GetLength());
+    std::vector<uint8_t> compressed;
+    if (length >= kGameActionBatchCompressionThreshold)
+    {
+        compressed = Compression::gzip(data, length);
+    }
+    if (!compressed.empty() && compressed.size() < length)
+    {
+        packet << kGameActionBatchFlagCompressed << _gameActionBatchCount;
+        packet.Write(compressed.data(), compressed.size());
+    }
+    else
+    {
+        packet << static_cast<uint8_t>(0) << _gameActionBatchCount;
+        packet.Write(data, length);
+    }
+
+    _gameActionBatch.Clear();
+    _gameActionBatchCount = 0;
 
     SendPacketToClients(packet);
 }
 
 void NetworkBase::ServerSendTick()
 {
+    // Actions of this tick have to arrive before the tick itself.
+    ServerFlushGameActions();
+
     NetworkPacket packet(NetworkCommand::Tick);
     packet << GetGameState().CurrentTicks << ScenarioRandState().s0;
     uint32_t flags = 0;
@@ -1732,40 +1807,44 @@ void NetworkBase::ServerSendEventPlayerDisconnected(const char* playerName, cons
     SendPacketToClients(packet);
 }
 
-bool NetworkBase::ProcessConnection(NetworkConnection& connection)
+bool NetworkBase::ProcessConnection(NetworkConnection& connection, bool hasData)
 {
-    NetworkReadPacket packetStatus;
-
-    uint32_t countProcessed = 0;
-    do
+    // Sockets without pending data would only report NoData, skip the read.
+    if (hasData)
     {
-        countProcessed++;
-        packetStatus = connection.ReadPacket();
-        switch (packetStatus)
+        NetworkReadPacket packetStatus;
+
+        uint32_t countProcessed = 0;
+        do
         {
-            case NetworkReadPacket::Disconnected:
-                // closed connection or network error
-                if (!connection.GetLastDisconnectReason())
-                {
-                    connection.SetLastDisconnectReason(STR_MULTIPLAYER_CONNECTION_CLOSED);
-                }
-                return false;
-            case NetworkReadPacket::Success:
-                // done reading in packet
-                ProcessPacket(connection, connection.InboundPacket);
-                if (!connection.IsValid())
-                {
+            countProcessed++;
+            packetStatus = connection.ReadPacket();
+            switch (packetStatus)
+            {
+                case NetworkReadPacket::Disconnected:
+                    // closed connection or network error
+                    if (!connection.GetLastDisconnectReason())
+                    {
+                        connection.SetLastDisconnectReason(STR_MULTIPLAYER_CONNECTION_CLOSED);
+                    }
                     return false;
-                }
-                break;
-            case NetworkReadPacket::MoreData:
-                // more data required to be read
-                break;
-            case NetworkReadPacket::NoData:
-                // could not read anything from socket
-                break;
-        }
-    } while (packetStatus == NetworkReadPacket::Success && countProcessed < kMaxPacketsPerUpdate);
+                case NetworkReadPacket::Success:
+                    // done reading in packet
+                    ProcessPacket(connection, connection.InboundPacket);
+                    if (!connection.IsValid())
+                    {
+                        return false;
+                    }
+                    break;
+                case NetworkReadPacket::MoreData:
+                    // more data required to be read
+                    break;
+                case NetworkReadPacket::NoData:
+                    // could not read anything from socket
+                    break;
+            }
+        } while (packetStatus == NetworkReadPacket::Success && countProcessed < kMaxPacketsPerUpdate);
+    }
 
     if (!connection.ReceivedPacketRecently())
     {
@@ -2973,7 +3052,74 @@ void NetworkBase::Client_Handle_GAME_ACTION([[maybe_unused]] NetworkConnection&
     stream.SetPosition(0);
 
     DataSerialiser ds(false, stream);
+    ClientEnqueueGameAction(tick, actionType, ds);
+}
+
+// Dropping the actions of a batch would silently desync the client, so it leaves the server instead.
+static void DisconnectOnInvalidGameActionBatch(NetworkConnection& connection, const char* reason)
+{
+    LOG_ERROR("Received invalid game action batch: %s", reason);
+    connection.SetLastDisconnectReason(STR_MULTIPLAYER_RECEIVED_INVALID_DATA);
+    connection.Disconnect();
+}
+
+void NetworkBase::Client_Handle_GAME_ACTION_BATCH(NetworkConnection& connection, NetworkPacket& packet)
+{
+    uint8_t flags;
+    uint32_t count;
+    packet >> flags >> count;
+
+    const size_t size = packet.Header.Size - packet.BytesRead;
+    const auto* data = packet.Read(size);
+    if (data == nullptr)
+    {
+        DisconnectOnInvalidGameActionBatch(connection, "no data");
+        return;
+    }
+
+    MemoryStream stream;
+    if (flags & kGameActionBatchFlagCompressed)
+    {
+        // The server flushes a batch before it grows past kChunkSize, only a single action can take it beyond that.
+        const auto maxSize = std::min(
+            static_cast<size_t>(count) * (kGameActionBatchEntryHeaderSize + kMaxGameActionSize),
+            kChunkSize + kGameActionBatchEntryHeaderSize + kMaxGameActionSize);
+        try
+        {
+            stream = MemoryStream(Compression::ungzip(data, size, maxSize));
+        }
+        catch (const std::runtime_error& e)
+        {
+            DisconnectOnInvalidGameActionBatch(connection, e.what());
+            return;
+        }
+    }
+    else
+    {
+        stream = MemoryStream(data, size);
+    }
+
+    DataSerialiser ds(false, stream);
+    for (uint32_t i = 0; i < count; i++)
+    {
+        uint32_t tick;
+        GameCommand actionType;
+        uint32_t actionLength;
+        ds << tick << actionType << actionLength;
+
+        const auto actionEnd = stream.GetPosition() + actionLength;
+        if (actionEnd > stream.GetLength())
+        {
+            DisconnectOnInvalidGameActionBatch(connection, "truncated");
+            return;
+        }
+        ClientEnqueueGameAction(tick, actionType, ds);
+        stream.SetPosition(actionEnd);
+    }
+}
 
+void NetworkBase::ClientEnqueueGameAction(uint32_t tick, GameCommand actionType, DataSerialiser& ds)
+{
     GameAction::Ptr action = GameActions::Create(actionType);
     if (action == nullptr)
     {
@@ -54,7 +54,7 @@ public: // Common
     void CloseChatLog();
     NetworkStats GetStats() const;
     json_t GetServerInfoAsJson() const;
-    bool ProcessConnection(NetworkConnection& connection);
+    bool ProcessConnection(NetworkConnection& connection, bool hasData = true);
     void CloseConnection();
     NetworkPlayer* AddPlayer(const std::string& name, const std::string& keyhash);
     void ProcessPacket(NetworkConnection& connection, NetworkPacket& packet);
@@ -89,6 +89,7 @@ public: // Server
     void ServerSendMap(NetworkConnection* connection = nullptr);
     void ServerSendChat(const char* text, const std::vector<uint8_t>& playerIds = {});
     void ServerSendGameAction(const GameAction* action);
+    void ServerFlushGameActions();
     void ServerSendTick();
     void ServerSendPlayerInfo(int32_t playerId);
     void ServerSendPlayerList();
@@ -151,6 +152,8 @@ public: // Client
     void Client_Handle_MAP(NetworkConnection& connection, NetworkPacket& packet);
     void Client_Handle_CHAT(NetworkConnection& connection, NetworkPacket& packet);
     void Client_Handle_GAME_ACTION(NetworkConnection& connection, NetworkPacket& packet);
+    void Client_Handle_GAME_ACTION_BATCH(NetworkConnection& connection, NetworkPacket& packet);
+    void ClientEnqueueGameAction(uint32_t tick, GameCommand actionType, DataSerialiser& ds);
     void Client_Handle_TICK(NetworkConnection& connection, NetworkPacket& packet);
     void Client_Handle_PLAYERINFO(NetworkConnection& connection, NetworkPacket& packet);
     void Client_Handle_PLAYERLIST(NetworkConnection& connection, NetworkPacket& packet);
@@ -205,6 +208,8 @@ private: // Server Data
     std::ofstream _server_log_fs;
     uint16_t listening_port = 0;
     bool _playerListInvalidated = false;
+    OpenRCT2::MemoryStream _gameActionBatch;
+    uint32_t _gameActionBatchCount = 0;
 
 private: // Client Data
     struct PlayerListUpdate
@@ -103,7 +103,7 @@ NetworkReadPacket NetworkConnection::ReadPacket()
     return NetworkReadPacket::MoreData;
 }
 
-static sfl::small_vector<uint8_t, 512> serializePacket(const NetworkPacket& packet)
+NetworkPacketBuffer NetworkConnection::SerialisePacket(const NetworkPacket& packet)
 {
     // NOTE: For compatibility reasons for the master server we need to add sizeof(Header.Id) to the size.
     // Previously the Id field was not part of the header rather part of the body.
@@ -116,11 +116,11 @@ static sfl::small_vector<uint8_t, 512> serializePacket(const NetworkPacket& pack
     header.Size = Convert::HostToNetwork(header.Size);
     header.Id = ByteSwapBE(header.Id);
 
-    sfl::small_vector<uint8_t, 512> buffer;
-    buffer.reserve(sizeof(header) + packet.Data.size());
+    auto buffer = std::make_shared<std::vector<uint8_t>>();
+    buffer->reserve(sizeof(header) + packet.Data.size());
 
-    buffer.insert(buffer.end(), reinterpret_cast<uint8_t*>(&header), reinterpret_cast<uint8_t*>(&header) + sizeof(header));
-    buffer.insert(buffer.end(), packet.Data.begin(), packet.Data.end());
+    buffer->insert(buffer->end(), reinterpret_cast<uint8_t*>(&header), reinterpret_cast<uint8_t*>(&header) + sizeof(header));
+    buffer->insert(buffer->end(), packet.Data.begin(), packet.Data.end());
 
     return buffer;
 }
@@ -129,14 +129,23 @@ void NetworkConnection::QueuePacket(const NetworkPacket& packet, bool front)
 {
     if (AuthStatus == NetworkAuth::Ok || !packet.CommandRequiresAuth())
     {
-        const auto payload = serializePacket(packet);
+        QueuePacket(packet, SerialisePacket(packet), front);
+    }
+}
+
+void NetworkConnection::QueuePacket(const NetworkPacket& packet, const NetworkPacketBuffer& buffer, bool front)
+{
+    if (AuthStatus == NetworkAuth::Ok || !packet.CommandRequiresAuth())
+    {
         if (front)
         {
-            _outboundBuffer.insert(_outboundBuffer.begin(), payload.begin(), payload.end());
+            // Never split a packet that has been partially sent already.
+            auto it = _outboundQueueOffset == 0 ? _outboundQueue.begin() : std::next(_outboundQueue.begin());
+            _outboundQueue.insert(it, buffer);
         }
         else
         {
-            _outboundBuffer.insert(_outboundBuffer.end(), payload.begin(), payload.end());
+            _outboundQueue.push_back(buffer);
         }
 
         RecordPacketStats(packet, true);
@@ -155,16 +164,32 @@ bool NetworkConnection::IsValid() const
 
 void NetworkConnection::SendQueuedData()
 {
-    if (_outboundBuffer.empty())
+    if (_outboundQueue.empty())
     {
         return;
     }
 
-    const auto bytesSent = Socket->SendData(_outboundBuffer.data(), _outboundBuffer.size());
+    // Hand every queued packet to the socket in one gathered write.
+    sfl::small_vector<SocketSendBuffer, 64> buffers;
+    for (const auto& buffer : _outboundQueue)
+    {
+        buffers.push_back({ buffer->data(), buffer->size() });
+    }
+    buffers.front().Data = _outboundQueue.front()->data() + _outboundQueueOffset;
+    buffers.front().Size -= _outboundQueueOffset;
 
-    if (bytesSent > 0)
+    auto bytesSent = Socket->SendData(buffers);
+    while (bytesSent > 0)
     {
-        _outboundBuffer.erase(_outboundBuffer.begin(), _outboundBuffer.begin() + bytesSent);
+        const auto remaining = _outboundQueue.front()->size() - _outboundQueueOffset;
+        if (bytesSent < remaining)
+        {
+            _outboundQueueOffset += bytesSent;
+            break;
+        }
+        bytesSent -= remaining;
+        _outboundQueueOffset = 0;
+        _outboundQueue.pop_front();
     }
 }
 
@@ -16,6 +16,7 @@
     #include "NetworkTypes.h"
     #include "Socket.h"
 
+    #include <deque>
     #include <memory>
     #include <string_view>
     #include <vector>
@@ -23,6 +24,10 @@
 class NetworkPlayer;
 struct ObjectRepositoryItem;
 
+// A packet in its wire format. Packets sent to several clients are serialised once and the buffer is shared by every
+// connection's send queue.
+using NetworkPacketBuffer = std::shared_ptr<const std::vector<uint8_t>>;
+
 class NetworkConnection final
 {
 public:
@@ -39,8 +44,11 @@ public:
 
     NetworkConnection() noexcept;
 
+    static NetworkPacketBuffer SerialisePacket(const NetworkPacket& packet);
+
     NetworkReadPacket ReadPacket();
     void QueuePacket(const NetworkPacket& packet, bool front = false);
+    void QueuePacket(const NetworkPacket& packet, const NetworkPacketBuffer& buffer, bool front = false);
 
     // This will not immediately disconnect the client. The disconnect
     // will happen post-tick.
@@ -56,7 +64,8 @@ public:
     void SetLastDisconnectReason(const StringId string_id, void* args = nullptr);
 
 private:
-    std::vector<uint8_t> _outboundBuffer;
+    std::deque<NetworkPacketBuffer> _outboundQueue;
+    size_t _outboundQueueOffset = 0; // Bytes of the first queued buffer that have already been sent.
     uint32_t _lastPacketTime = 0;
     std::string _lastDisconnectReason;
 
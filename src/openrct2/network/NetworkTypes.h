@@ -83,6 +83,7 @@ enum class NetworkCommand : uint32_t
     ScriptsHeader,
     ScriptsData,
     Heartbeat,
+    GameActionBatch,
     Max,
     Invalid = static_cast<uint32_t>(-1),
 };
@@ -51,10 +51,12 @@
     #include <netdb.h>
     #include <netinet/in.h>
     #include <netinet/tcp.h>
+    #include <poll.h>
     #include <sys/ioctl.h>
     #include <sys/select.h>
     #include <sys/socket.h>
     #include <sys/time.h>
+    #include <sys/uio.h>
     #include <unistd.h>
 
     using SOCKET = int32_t;
@@ -75,6 +77,9 @@
 
 constexpr auto kConnectTimeout = std::chrono::milliseconds(3000);
 
+// Maximum number of buffers handed to a single gathered send call, well below IOV_MAX.
+constexpr size_t kMaxSendBuffers = 64;
+
     // RAII WSA initialisation needed for Windows
     #ifdef _WIN32
 class WSA
@@ -270,6 +275,11 @@ public:
     {
     }
 
+    SOCKET GetHandle() const noexcept
+    {
+        return _socket;
+    }
+
     ~TcpSocket() override
     {
         if (_connectFuture.valid())
@@ -572,6 +582,78 @@ public:
         return totalSent;
     }
 
+    size_t SendData(std::span<const SocketSendBuffer> buffers) override
+    {
+        if (_status != SocketStatus::Connected)
+        {
+            throw std::runtime_error("Socket not connected.");
+        }
+
+        size_t totalSent = 0;
+        size_t index = 0;
+        size_t offset = 0;
+        while (index < buffers.size())
+        {
+    #ifdef _WIN32
+            WSABUF sendBuffers[kMaxSendBuffers];
+    #else
+            iovec sendBuffers[kMaxSendBuffers];
+    #endif
+            size_t numSendBuffers = 0;
+            for (size_t i = index; i < buffers.size() && numSendBuffers < kMaxSendBuffers; i++)
+            {
+                const auto skip = i == index ? offset : 0;
+                if (buffers[i].Size == skip)
+                {
+                    continue;
+                }
+                auto* data = static_cast<const char*>(buffers[i].Data) + skip;
+    #ifdef _WIN32
+                sendBuffers[numSendBuffers].buf = const_cast<char*>(data);
+                sendBuffers[numSendBuffers].len = static_cast<ULONG>(buffers[i].Size - skip);
+    #else
+                sendBuffers[numSendBuffers].iov_base = const_cast<char*>(data);
+                sendBuffers[numSendBuffers].iov_len = buffers[i].Size - skip;
+    #endif
+                numSendBuffers++;
+            }
+            if (numSendBuffers == 0)
+            {
+                break;
+            }
+
+    #ifdef _WIN32
+            DWORD sentBytes = 0;
+            if (WSASend(_socket, sendBuffers, static_cast<DWORD>(numSendBuffers), &sentBytes, 0, nullptr, nullptr)
+                == SOCKET_ERROR)
+            {
+                return totalSent;
+            }
+    #else
+            msghdr message{};
+            message.msg_iov = sendBuffers;
+            message.msg_iovlen = numSendBuffers;
+            auto sentBytes = sendmsg(_socket, &message, FLAG_NO_PIPE);
+            if (sentBytes == SOCKET_ERROR)
+            {
+                return totalSent;
+            }
+    #endif
+            totalSent += sentBytes;
+
+            // Advance past everything that was sent.
+            size_t remaining = sentBytes;
+            while (index < buffers.size() && remaining >= buffers[index].Size - offset)
+            {
+                remaining -= buffers[index].Size - offset;
+                offset = 0;
+                index++;
+            }
+            offset += remaining;
+        }
+        return totalSent;
+    }
+
     NetworkReadPacket ReceiveData(void* buffer, size_t size, size_t* sizeReceived) override
     {
         if (_status != SocketStatus::Connected)
@@ -874,6 +956,52 @@ std::unique_ptr<IUdpSocket> CreateUdpSocket()
     return std::make_unique<UdpSocket>();
 }
 
+std::vector<bool> GetReadableSockets(std::span<ITcpSocket* const> sockets)
+{
+    std::vector<bool> readable(sockets.size(), true);
+    #ifdef _WIN32
+    std::vector<WSAPOLLFD> pollFds;
+    #else
+    std::vector<pollfd> pollFds;
+    #endif
+    std::vector<size_t> pollIndices;
+    pollFds.reserve(sockets.size());
+    pollIndices.reserve(sockets.size());
+    for (size_t i = 0; i < sockets.size(); i++)
+    {
+        const auto* tcpSocket = dynamic_cast<const TcpSocket*>(sockets[i]);
+        if (tcpSocket == nullptr || tcpSocket->GetHandle() == INVALID_SOCKET)
+        {
+            continue;
+        }
+        auto& pollFd = pollFds.emplace_back();
+        pollFd.fd = tcpSocket->GetHandle();
+        pollFd.events = POLLIN;
+        pollIndices.push_back(i);
+    }
+    if (pollFds.empty())
+    {
+        return readable;
+    }
+
+    #ifdef _WIN32
+    const auto result = WSAPoll(pollFds.data(), static_cast<ULONG>(pollFds.size()), 0);
+    #else
+    const auto result = poll(pollFds.data(), static_cast<nfds_t>(pollFds.size()), 0);
+    #endif
+    if (result == SOCKET_ERROR)
+    {
+        // Let the caller find out what is wrong by reading from every socket.
+        return readable;
+    }
+    for (size_t i = 0; i < pollFds.size(); i++)
+    {
+        // Hang ups and errors count as readable, reading is how the connection notices.
+        readable[pollIndices[i]] = pollFds[i].revents != 0;
+    }
+    return readable;
+}
+
     #ifdef _WIN32
 static std::vector<INTERFACE_INFO> GetNetworkInterfaces()
 {
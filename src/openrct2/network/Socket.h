@@ -10,6 +10,7 @@
 #pragma once
 
 #include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -43,6 +44,15 @@ struct INetworkEndpoint
     virtual std::string GetHostname() const = 0;
 };
 
+/**
+ * A block of memory to send as part of a gathered write.
+ */
+struct SocketSendBuffer
+{
+    const void* Data{};
+    size_t Size{};
+};
+
 /**
  * Represents a TCP socket / connection or listener.
  */
@@ -64,6 +74,7 @@ public:
     virtual void ConnectAsync(const std::string& address, uint16_t port) = 0;
 
     virtual size_t SendData(const void* buffer, size_t size) = 0;
+    virtual size_t SendData(std::span<const SocketSendBuffer> buffers) = 0;
     virtual NetworkReadPacket ReceiveData(void* buffer, size_t size, size_t* sizeReceived) = 0;
 
     virtual void SetNoDelay(bool noDelay) = 0;
@@ -99,6 +110,9 @@ public:
 
 [[nodiscard]] std::unique_ptr<ITcpSocket> CreateTcpSocket();
 [[nodiscard]] std::unique_ptr<IUdpSocket> CreateUdpSocket();
+// Checks in a single call, without blocking, which sockets have data waiting or have been closed. Sockets that can not
+// be polled are reported as readable so the caller falls back to attempting a read.
+[[nodiscard]] std::vector<bool> GetReadableSockets(std::span<ITcpSocket* const> sockets);
 [[nodiscard]] std::vector<std::unique_ptr<INetworkEndpoint>> GetBroadcastAddresses();
 
 namespace OpenRCT2::Convert
@@ -18,6 +18,7 @@
 #include "../core/JobPool.h"
 #include "../core/Memory.hpp"
 #include "../localisation/StringIds.h"
+#include "../paint/PaintTileCache.h"
 #include "../ride/Ride.h"
 #include "../ride/RideAudio.h"
 #include "../ui/WindowManager.h"
@@ -488,6 +489,9 @@ private:
 
     void UpdateSceneryGroupIndexes()
     {
+        // Cached tile paint calls refer to images and entries of the loaded objects.
+        PaintTileCacheInvalidate();
+
         UpdateSceneryGroupIndexes<SmallSceneryEntry>(ObjectType::SmallScenery);
         UpdateSceneryGroupIndexes<LargeSceneryEntry>(ObjectType::LargeScenery);
         UpdateSceneryGroupIndexes<WallSceneryEntry>(ObjectType::Walls);
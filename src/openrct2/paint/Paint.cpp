@@ -24,11 +24,13 @@
 #include "../profiling/Profiling.h"
 #include "Boundbox.h"
 #include "Paint.Entity.h"
+#include "PaintTileCache.h"
 #include "tile_element/Paint.TileElement.h"
 
 #include <algorithm>
 #include <array>
 #include <cassert>
+#include <sfl/small_vector.hpp>
 
 using namespace OpenRCT2;
 using namespace OpenRCT2::Numerics;
@@ -184,7 +186,8 @@ static PaintStruct* CreateNormalPaintStruct(
 
     const auto imagePos = Translate3DTo2DWithZ(session.CurrentRotation, swappedRotCoord);
 
-    if (!ImageWithinDPI(imagePos, *g1, session.DPI))
+    // Tiles are recorded without culling so the recording can be replayed against any DPI.
+    if (session.TileRecording == nullptr && !ImageWithinDPI(imagePos, *g1, session.DPI))
     {
         return nullptr;
     }
@@ -837,6 +840,11 @@ PaintStruct* PaintAddImageAsParent(
     session.LastAttachedPS = nullptr;
 
     auto* ps = CreateNormalPaintStruct(session, image_id, offset, boundBox);
+    if (session.TileRecording != nullptr)
+    {
+        session.TileRecording->AddStruct(PaintTileOpType::Parent, nullptr, ps);
+        return ps;
+    }
     if (ps == nullptr)
     {
         return nullptr;
@@ -869,7 +877,12 @@ PaintStruct* PaintAddImageAsParent(
 {
     session.LastPS = nullptr;
     session.LastAttachedPS = nullptr;
-    return CreateNormalPaintStruct(session, imageId, offset, boundBox);
+    auto* ps = CreateNormalPaintStruct(session, imageId, offset, boundBox);
+    if (session.TileRecording != nullptr)
+    {
+        session.TileRecording->AddStruct(PaintTileOpType::Orphan, nullptr, ps);
+    }
+    return ps;
 }
 
 /**
@@ -895,10 +908,18 @@ PaintStruct* PaintAddImageAsChild(
     PaintStruct* parentPS = session.LastPS;
     if (parentPS == nullptr)
     {
+        if (session.TileRecording != nullptr)
+        {
+            session.TileRecording->Observe();
+        }
         return PaintAddImageAsParent(session, image_id, offset, boundBox);
     }
 
     auto* ps = CreateNormalPaintStruct(session, image_id, offset, boundBox);
+    if (session.TileRecording != nullptr)
+    {
+        session.TileRecording->AddStruct(PaintTileOpType::Child, parentPS, ps);
+    }
     if (ps == nullptr)
     {
         return nullptr;
@@ -938,6 +959,11 @@ bool PaintAttachToPreviousAttach(PaintSession& session, const ImageId imageId, i
 
     previousAttachedPS->NextEntry = ps;
 
+    if (session.TileRecording != nullptr)
+    {
+        session.TileRecording->AddAttached(PaintTileOpType::AttachToAttached, session.LastPS, ps);
+    }
+
     return true;
 }
 
@@ -952,6 +978,10 @@ bool PaintAttachToPreviousAttach(PaintSession& session, const ImageId imageId, i
 bool PaintAttachToPreviousPS(PaintSession& session, const ImageId image_id, int32_t x, int32_t y)
 {
     auto* masterPs = session.LastPS;
+    if (session.TileRecording != nullptr)
+    {
+        session.TileRecording->Observe();
+    }
     if (masterPs == nullptr)
     {
         return false;
@@ -971,9 +1001,130 @@ bool PaintAttachToPreviousPS(PaintSession& session, const ImageId image_id, int3
     masterPs->Attached = ps;
     ps->NextEntry = oldFirstAttached;
 
+    if (session.TileRecording != nullptr)
+    {
+        session.TileRecording->AddAttached(PaintTileOpType::AttachToPS, masterPs, ps);
+    }
+
     return true;
 }
 
+static PaintStruct* ReplayNormalPaintStruct(PaintSession& session, const PaintTileOp& op)
+{
+    if (!op.HasImage)
+    {
+        return nullptr;
+    }
+
+    auto* const g1 = GfxGetG1Element(op.Image);
+    if (g1 == nullptr || !ImageWithinDPI(op.ScreenPos, *g1, session.DPI))
+    {
+        return nullptr;
+    }
+
+    auto* ps = session.AllocateNormalPaintEntry();
+    ps->image_id = op.Image;
+    ps->ScreenPos = op.ScreenPos;
+    ps->Bounds = op.Bounds;
+    ps->Attached = nullptr;
+    ps->Children = nullptr;
+    ps->NextQuadrantEntry = nullptr;
+    ps->InteractionItem = op.InteractionItem;
+    ps->MapPos = op.MapPos;
+    ps->Element = const_cast<TileElement*>(op.Element);
+    ps->Entity = session.CurrentlyDrawnEntity;
+    return ps;
+}
+
+static AttachedPaintStruct* ReplayAttachedPaintStruct(PaintSession& session, const PaintTileOp& op)
+{
+    auto* ps = session.AllocateAttachedPaintEntry();
+    ps->image_id = op.Image;
+    ps->ColourImageId = op.ColourImage;
+    ps->RelativePos = op.ScreenPos;
+    ps->IsMasked = op.IsMasked;
+    ps->NextEntry = nullptr;
+    return ps;
+}
+
+/**
+ * Repeats the paint calls of a recorded tile against the session's DPI, following the same rules as
+ * PaintAddImageAsParent, PaintAddImageAsChild and the attach functions would have with culling applied.
+ */
+void PaintSessionReplayTile(
+    PaintSession& session, const std::vector<PaintTileOp>& ops, const std::vector<PaintStruct*>& external,
+    int16_t finalLastPS)
+{
+    // What session.LastPS was after each op, the recorded LastPS indices refer to these.
+    sfl::small_vector<PaintStruct*, 64> lastPSAfterOp(ops.size(), nullptr);
+    const auto resolveLastPS = [&](int16_t index) -> PaintStruct* {
+        if (index >= 0)
+            return lastPSAfterOp[index];
+        if (index == kPaintTileOpNone)
+            return nullptr;
+        return external[kPaintTileOpNone - index - 1];
+    };
+
+    for (size_t i = 0; i < ops.size(); i++)
+    {
+        const auto& op = ops[i];
+        switch (op.Type)
+        {
+            case PaintTileOpType::Parent:
+            case PaintTileOpType::Orphan:
+            case PaintTileOpType::Child:
+            {
+                PaintStruct* parentPS = nullptr;
+                if (op.Type == PaintTileOpType::Child)
+                {
+                    parentPS = resolveLastPS(op.LastPS);
+                    session.LastPS = parentPS;
+                }
+                if (parentPS == nullptr)
+                {
+                    session.LastPS = nullptr;
+                    session.LastAttachedPS = nullptr;
+                }
+
+                auto* ps = ReplayNormalPaintStruct(session, op);
+                if (ps != nullptr)
+                {
+                    if (parentPS != nullptr)
+                        parentPS->Children = ps;
+                    else if (op.Type != PaintTileOpType::Orphan)
+                        PaintSessionAddPSToQuadrant(session, ps);
+                    else if (session.WoodenSupportsPrependTo != nullptr)
+                        session.WoodenSupportsPrependTo->Children = ps;
+                }
+                break;
+            }
+            case PaintTileOpType::AttachToPS:
+            case PaintTileOpType::AttachToAttached:
+            {
+                session.LastPS = resolveLastPS(op.LastPS);
+                auto* previousAttachedPS = session.LastAttachedPS;
+                if (op.Type == PaintTileOpType::AttachToAttached && previousAttachedPS != nullptr)
+                {
+                    previousAttachedPS->NextEntry = ReplayAttachedPaintStruct(session, op);
+                }
+                else if (session.LastPS != nullptr)
+                {
+                    auto* masterPs = session.LastPS;
+                    auto* ps = ReplayAttachedPaintStruct(session, op);
+                    ps->NextEntry = masterPs->Attached;
+                    masterPs->Attached = ps;
+                }
+                break;
+            }
+        }
+        lastPSAfterOp[i] = session.LastPS;
+    }
+    if (finalLastPS != kPaintTileOpUnchanged)
+    {
+        session.LastPS = resolveLastPS(finalLastPS);
+    }
+}
+
 /**
  * rct2: 0x00685EBC, 0x00686046, 0x00685FC8, 0x00685F4A, 0x00685ECC
  * @param amount (eax)
@@ -17,14 +17,15 @@
 #include "Boundbox.h"
 #include "tile_element/Paint.Tunnel.h"
 
+#include <memory>
 #include <mutex>
-#include <sfl/segmented_vector.hpp>
-#include <sfl/static_vector.hpp>
 #include <thread>
+#include <vector>
 
 struct EntityBase;
 struct TileElement;
 struct SurfaceElement;
+struct PaintTileRecording;
 enum class RailingEntrySupportType : uint8_t;
 enum class ViewportInteractionItem : uint8_t;
 
@@ -139,6 +140,7 @@ struct PaintSessionCore
     const TileElement* TrackElementOnSameHeight;
     const TileElement* SelectedElement;
     PaintStruct* WoodenSupportsPrependTo;
+    PaintTileRecording* TileRecording;
     CoordsXY SpritePosition;
     CoordsXY MapPosition;
     uint32_t ViewFlags;
@@ -161,31 +163,38 @@ struct PaintSessionCore
 
 struct PaintNodeStorage
 {
-    // 1024 is typically enough to cover the column, after its full it will use dynamicPaintEntries.
-    sfl::static_vector<PaintEntry, 1024> fixedPaintEntries;
+    static constexpr size_t kChunkSize = 256;
 
-    // This has to be wrapped in optional as it allocates memory before it is used.
-    std::optional<sfl::segmented_vector<PaintEntry, 256>> dynamicPaintEntries;
+    // Chunks are kept when the storage is cleared, so a session that is reused for the same column next frame does
+    // not allocate again.
+    std::vector<std::unique_ptr<PaintEntry[]>> chunks;
+    size_t chunkIndex{};
+    size_t entryIndex{};
 
     PaintEntry* allocate()
     {
-        if (!fixedPaintEntries.full())
+        if (entryIndex == kChunkSize)
         {
-            return &fixedPaintEntries.emplace_back();
+            chunkIndex++;
+            entryIndex = 0;
         }
-
-        if (!dynamicPaintEntries.has_value())
+        if (chunkIndex == chunks.size())
         {
-            dynamicPaintEntries.emplace();
+            // Not value initialised, entries are constructed by the As* functions.
+            chunks.emplace_back(new PaintEntry[kChunkSize]);
         }
-
-        return &dynamicPaintEntries->emplace_back();
+        return &chunks[chunkIndex][entryIndex++];
     }
 
     void clear()
     {
-        fixedPaintEntries.clear();
-        dynamicPaintEntries.reset();
+        // Only keep as many chunks as were needed this time so one unusually busy frame does not hold on to memory.
+        if (!chunks.empty())
+        {
+            chunks.resize(chunkIndex + 1);
+        }
+        chunkIndex = 0;
+        entryIndex = 0;
     }
 };
 
@@ -0,0 +1,558 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2025 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "PaintTileCache.h"
+
+#include "../OpenRCT2.h"
+#include "../config/Config.h"
+#include "../drawing/LightFX.h"
+#include "../entity/PatrolArea.h"
+#include "../interface/Viewport.h"
+#include "../object/PathAdditionEntry.h"
+#include "../object/SmallSceneryEntry.h"
+#include "../object/WallSceneryEntry.h"
+#include "../profiling/Profiling.h"
+#include "../ride/TrackDesign.h"
+#include "../world/Banner.h"
+#include "../world/Map.h"
+#include "../world/tile_element/PathElement.h"
+#include "../world/tile_element/SmallSceneryElement.h"
+#include "../world/tile_element/SurfaceElement.h"
+#include "../world/tile_element/TileElement.h"
+#include "../world/tile_element/WallElement.h"
+#include "Paint.SessionFlags.h"
+#include "tile_element/Paint.TileElement.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <unordered_map>
+
+using namespace OpenRCT2;
+
+// View flags that do not change what is painted for a tile, masked out so viewports can share entries.
+static constexpr uint32_t kIgnoredViewFlags = VIEWPORT_FLAG_SOUND_ON | VIEWPORT_FLAG_INDEPEDENT_ROTATION
+    | VIEWPORT_FLAG_RENDERING_INHIBITED;
+
+static constexpr size_t kNumShards = 64;
+static constexpr size_t kMinEntriesPerShard = 1024;
+// Views that paint more tiles than this are not cached, every tile would be evicted before it is painted again.
+static constexpr size_t kMaxEntries = 128 * 1024;
+
+namespace
+{
+    struct TileCacheKey
+    {
+        TileCoordsXY Tile;
+        uint32_t ViewFlags;
+        int32_t HeightMarkerOffset;
+        int8_t Zoom;
+        uint8_t Rotation;
+        bool LandscapeSmoothing;
+        bool TransparentWater;
+
+        bool operator==(const TileCacheKey& other) const = default;
+    };
+
+    struct TileCacheKeyHash
+    {
+        size_t operator()(const TileCacheKey& key) const
+        {
+            auto hash = static_cast<size_t>(key.Tile.x) * 73856093u;
+            hash ^= static_cast<size_t>(key.Tile.y) * 19349663u;
+            hash ^= static_cast<size_t>(key.ViewFlags) * 83492791u;
+            hash ^= (static_cast<size_t>(key.Zoom) << 8) | key.Rotation;
+            return hash;
+        }
+    };
+
+    struct TileCacheEntry
+    {
+        uint64_t Version;
+        // Set if the tile contains something that has to be painted every time.
+        bool Uncacheable;
+        std::vector<PaintTileOp> Ops;
+        PaintTileEndState EndState;
+        int16_t FinalLastPS;
+    };
+
+    struct TileCacheSlot
+    {
+        TileCacheKey Key;
+        std::shared_ptr<const TileCacheEntry> Entry;
+        // Set when the entry is used, cleared as the clock hand passes. Written under the shared lock.
+        std::atomic<bool> Referenced;
+    };
+
+    struct TileCacheShard
+    {
+        std::shared_mutex Mutex;
+        std::unordered_map<TileCacheKey, size_t, TileCacheKeyHash> Index;
+        // A deque so slots never move, the atomics in them cannot be.
+        std::deque<TileCacheSlot> Slots;
+        size_t Hand{};
+    };
+} // namespace
+
+static std::array<TileCacheShard, kNumShards> _shards;
+static std::atomic<size_t> _entriesPerShard{ kMinEntriesPerShard };
+static std::atomic<bool> _viewFits{ true };
+static bool _enabled = true;
+static bool _statsEnabled = false;
+static std::atomic<uint64_t> _hits;
+static std::atomic<uint64_t> _misses;
+static std::atomic<uint64_t> _bypassed;
+static thread_local PaintTileRecording _recording;
+
+static void CountTile(std::atomic<uint64_t>& counter)
+{
+    if (_statsEnabled)
+    {
+        counter.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void PaintTileRecording::Begin(const PaintSession& session)
+{
+    Ops.clear();
+    Allocated.clear();
+    External.clear();
+    StartLastPS = session.LastPS;
+    StartLastAttachedPS = session.LastAttachedPS;
+    FinalLastPS = kPaintTileOpNone;
+    HasParent = false;
+    Storable = true;
+}
+
+void PaintTileRecording::End(const PaintSession& session)
+{
+    // Copy the structs now, the paint functions may have changed them after they were added.
+    for (size_t i = 0; i < Ops.size(); i++)
+    {
+        auto& op = Ops[i];
+        if (Allocated[i] == nullptr)
+        {
+            continue;
+        }
+        if (op.Type == PaintTileOpType::AttachToPS || op.Type == PaintTileOpType::AttachToAttached)
+        {
+            const auto* attached = static_cast<const AttachedPaintStruct*>(Allocated[i]);
+            op.Image = attached->image_id;
+            op.ColourImage = attached->ColourImageId;
+            op.ScreenPos = attached->RelativePos;
+            op.IsMasked = attached->IsMasked;
+        }
+        else
+        {
+            const auto* ps = static_cast<const PaintStruct*>(Allocated[i]);
+            op.Bounds = ps->Bounds;
+            op.Element = ps->Element;
+            op.Image = ps->image_id;
+            op.ScreenPos = ps->ScreenPos;
+            op.MapPos = ps->MapPos;
+            op.InteractionItem = ps->InteractionItem;
+        }
+    }
+
+    // Without a parent op nothing on this tile changed session.LastPS, so it is left as it was.
+    FinalLastPS = HasParent ? IndexOf(session.LastPS) : kPaintTileOpUnchanged;
+
+    EndState.Surface = session.Surface;
+    EndState.CurrentlyDrawnTileElement = session.CurrentlyDrawnTileElement;
+    EndState.SpritePosition = session.SpritePosition;
+    EndState.WaterHeight = session.WaterHeight;
+    EndState.Flags = session.Flags;
+    EndState.InteractionType = session.InteractionType;
+}
+
+void PaintTileRecording::Observe()
+{
+    // Before the first parent op session.LastPS and session.LastAttachedPS still hold whatever was painted before
+    // this tile.
+    if (!HasParent)
+    {
+        Storable = false;
+    }
+}
+
+void PaintTileRecording::AddStruct(PaintTileOpType type, const PaintStruct* lastPS, const PaintStruct* ps)
+{
+    auto& op = Ops.emplace_back();
+    op.Type = type;
+    op.HasImage = ps != nullptr;
+    op.LastPS = kPaintTileOpNone;
+    if (type == PaintTileOpType::Child)
+    {
+        Observe();
+        op.LastPS = IndexOf(lastPS);
+    }
+    else
+    {
+        HasParent = true;
+        if (type == PaintTileOpType::Orphan)
+        {
+            // Linked to a paint struct from another tile by the caller.
+            Storable = false;
+        }
+    }
+    Allocated.push_back(const_cast<PaintStruct*>(ps));
+}
+
+void PaintTileRecording::AddAttached(PaintTileOpType type, const PaintStruct* lastPS, const AttachedPaintStruct* ps)
+{
+    Observe();
+    auto& op = Ops.emplace_back();
+    op.Type = type;
+    op.HasImage = true;
+    op.LastPS = IndexOf(lastPS);
+    Allocated.push_back(const_cast<AttachedPaintStruct*>(ps));
+}
+
+int16_t PaintTileRecording::IndexOf(const PaintStruct* ps)
+{
+    if (ps == nullptr)
+    {
+        return kPaintTileOpNone;
+    }
+    for (size_t i = Ops.size(); i > 0; i--)
+    {
+        const auto type = Ops[i - 1].Type;
+        if (Allocated[i - 1] == ps && type != PaintTileOpType::AttachToPS && type != PaintTileOpType::AttachToAttached)
+        {
+            return static_cast<int16_t>(i - 1);
+        }
+    }
+
+    Storable = false;
+    External.push_back(const_cast<PaintStruct*>(ps));
+    return static_cast<int16_t>(kPaintTileOpNone - static_cast<int16_t>(External.size()));
+}
+
+static bool IsCacheEnabledForSession(const PaintSession& session)
+{
+    if (session.ViewFlags & (VIEWPORT_FLAG_CLIP_VIEW | VIEWPORT_FLAG_LAND_OWNERSHIP))
+        return false;
+    if (session.Flags & PaintSessionFlags::IsTrackPiecePreview)
+        return false;
+    if (gTrackDesignSaveMode || (gScreenFlags & (SCREEN_FLAGS_TRACK_DESIGNER | SCREEN_FLAGS_TRACK_MANAGER)))
+        return false;
+    if (gPaintBlockedTiles || gPaintWidePathsAsGhost || gShowSupportSegmentHeights)
+        return false;
+
+    const auto patrolAreaToRender = GetPatrolAreaToRender();
+    const auto* staffId = std::get_if<EntityId>(&patrolAreaToRender);
+    return staffId != nullptr && staffId->IsNull();
+}
+
+static bool IsTileSelected(const CoordsXY& pos)
+{
+    if ((gMapSelectFlags & MAP_SELECT_FLAG_ENABLE) && pos.x >= gMapSelectPositionA.x && pos.x <= gMapSelectPositionB.x
+        && pos.y >= gMapSelectPositionA.y && pos.y <= gMapSelectPositionB.y)
+    {
+        return true;
+    }
+    if (gMapSelectFlags & MAP_SELECT_FLAG_ENABLE_CONSTRUCT)
+    {
+        for (const auto& tile : gMapSelectionTiles)
+        {
+            if (tile == pos)
+                return true;
+        }
+    }
+    return false;
+}
+
+// Whether painting the element only depends on the element itself, the surrounding surfaces and the cache key.
+static bool IsElementCacheable(const TileElement& element)
+{
+    switch (element.GetType())
+    {
+        case TileElementType::Surface:
+            return true;
+        case TileElementType::Path:
+        {
+            const auto* pathElement = element.AsPath();
+            // Queue banners show the ride status.
+            if (pathElement->IsQueue())
+                return false;
+            if (pathElement->HasAddition())
+            {
+                const auto* additionEntry = pathElement->GetAdditionEntry();
+                if (additionEntry != nullptr)
+                {
+                    if (additionEntry->draw_type == PathAdditionDrawType::JumpingFountain)
+                        return false;
+                    // Lamps add light effects while being painted.
+                    if (additionEntry->draw_type == PathAdditionDrawType::Light && Drawing::LightFx::IsAvailable())
+                        return false;
+                }
+            }
+            return true;
+        }
+        case TileElementType::Wall:
+        {
+            const auto* wallEntry = element.AsWall()->GetEntry();
+            return wallEntry == nullptr
+                || (!(wallEntry->flags2 & WALL_SCENERY_2_ANIMATED) && wallEntry->scrolling_mode == SCROLLING_MODE_NONE);
+        }
+        case TileElementType::SmallScenery:
+        {
+            const auto* sceneryEntry = element.AsSmallScenery()->GetEntry();
+            return sceneryEntry == nullptr || !sceneryEntry->HasFlag(SMALL_SCENERY_FLAG_ANIMATED);
+        }
+        default:
+            return false;
+    }
+}
+
+static uint64_t HashWords(uint64_t hash, const void* data, size_t size)
+{
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; i += sizeof(uint64_t))
+    {
+        uint64_t word;
+        std::memcpy(&word, bytes + i, sizeof(word));
+        hash = (hash ^ word) * 0x100000001B3ull;
+    }
+    return hash;
+}
+
+/**
+ * Hashes everything the tile's paint calls read from the map: its elements, where they are in memory (paint structs
+ * point at them) and the surfaces of the neighbouring tiles that the surface edges are painted against. Returns
+ * std::nullopt if the tile has to be painted directly.
+ */
+static std::optional<uint64_t> GetTileVersion(const PaintSession& session, const TileElement* firstElement)
+{
+    static_assert(sizeof(TileElement) % sizeof(uint64_t) == 0);
+
+    uint64_t hash = 0xCBF29CE484222325ull;
+    const auto address = reinterpret_cast<uintptr_t>(firstElement);
+    hash = HashWords(hash, &address, sizeof(address));
+
+    const auto* element = firstElement;
+    do
+    {
+        if (!IsElementCacheable(*element) || element == session.SelectedElement)
+        {
+            return std::nullopt;
+        }
+    } while (!(element++)->IsLastForTile());
+    hash = HashWords(hash, firstElement, (element - firstElement) * sizeof(TileElement));
+
+    static constexpr CoordsXY kNeighbours[] = { { kCoordsXYStep, 0 }, { 0, kCoordsXYStep }, { -kCoordsXYStep, 0 },
+                                                { 0, -kCoordsXYStep } };
+    for (const auto& offset : kNeighbours)
+    {
+        const auto position = session.MapPosition + offset;
+        const SurfaceElement* surfaceElement = MapIsLocationValid(position) ? MapGetSurfaceElementAt(position) : nullptr;
+        if (surfaceElement != nullptr)
+        {
+            hash = HashWords(hash, surfaceElement, sizeof(TileElement));
+        }
+        else
+        {
+            hash = HashWords(hash, &offset, sizeof(offset));
+        }
+    }
+    return hash;
+}
+
+static TileCacheShard& GetShard(const TileCacheKey& key)
+{
+    return _shards[(key.Tile.x * 31 + key.Tile.y) % kNumShards];
+}
+
+static std::shared_ptr<const TileCacheEntry> FindEntry(TileCacheShard& shard, const TileCacheKey& key)
+{
+    std::shared_lock lock(shard.Mutex);
+    auto it = shard.Index.find(key);
+    if (it == shard.Index.end())
+    {
+        return nullptr;
+    }
+    auto& slot = shard.Slots[it->second];
+    slot.Referenced.store(true, std::memory_order_relaxed);
+    return slot.Entry;
+}
+
+static void StoreEntry(TileCacheShard& shard, const TileCacheKey& key, std::shared_ptr<const TileCacheEntry> entry)
+{
+    std::unique_lock lock(shard.Mutex);
+    auto it = shard.Index.find(key);
+    if (it != shard.Index.end())
+    {
+        auto& slot = shard.Slots[it->second];
+        slot.Entry = std::move(entry);
+        slot.Referenced.store(true, std::memory_order_relaxed);
+        return;
+    }
+
+    if (shard.Slots.size() < _entriesPerShard.load(std::memory_order_relaxed))
+    {
+        shard.Index.emplace(key, shard.Slots.size());
+        auto& slot = shard.Slots.emplace_back();
+        slot.Key = key;
+        slot.Entry = std::move(entry);
+        slot.Referenced.store(false, std::memory_order_relaxed);
+        return;
+    }
+
+    // Clock eviction, replace the first entry that was not used since the hand last passed it.
+    while (shard.Slots[shard.Hand].Referenced.exchange(false, std::memory_order_relaxed))
+    {
+        shard.Hand = (shard.Hand + 1) % shard.Slots.size();
+    }
+    auto& slot = shard.Slots[shard.Hand];
+    shard.Index.erase(slot.Key);
+    shard.Index.emplace(key, shard.Hand);
+    slot.Key = key;
+    slot.Entry = std::move(entry);
+    shard.Hand = (shard.Hand + 1) % shard.Slots.size();
+}
+
+static void ApplyEndState(PaintSession& session, const PaintTileEndState& endState)
+{
+    session.Surface = endState.Surface;
+    session.CurrentlyDrawnTileElement = endState.CurrentlyDrawnTileElement;
+    session.SpritePosition = endState.SpritePosition;
+    session.WaterHeight = endState.WaterHeight;
+    session.Flags = endState.Flags;
+    session.InteractionType = endState.InteractionType;
+}
+
+void PaintTileCachePaint(PaintSession& session, TileElement* firstElement, bool partOfVirtualFloor)
+{
+    PROFILED_FUNCTION();
+
+    if (!_enabled || !_viewFits.load(std::memory_order_relaxed) || partOfVirtualFloor || !IsCacheEnabledForSession(session)
+        || IsTileSelected(session.MapPosition))
+    {
+        CountTile(_bypassed);
+        PaintTileElements(session, firstElement);
+        return;
+    }
+
+    const auto version = GetTileVersion(session, firstElement);
+    if (!version.has_value())
+    {
+        CountTile(_bypassed);
+        PaintTileElements(session, firstElement);
+        return;
+    }
+
+    const auto& config = Config::Get().general;
+    const TileCacheKey key = {
+        TileCoordsXY(session.MapPosition),
+        session.ViewFlags & ~kIgnoredViewFlags,
+        GetHeightMarkerOffset(),
+        static_cast<int8_t>(session.DPI.zoom_level),
+        session.CurrentRotation,
+        config.LandscapeSmoothing,
+        config.TransparentWater,
+    };
+    auto& shard = GetShard(key);
+
+    auto entry = FindEntry(shard, key);
+    if (entry != nullptr && entry->Version == *version)
+    {
+        if (entry->Uncacheable)
+        {
+            CountTile(_bypassed);
+            PaintTileElements(session, firstElement);
+            return;
+        }
+        CountTile(_hits);
+        ApplyEndState(session, entry->EndState);
+        PaintSessionReplayTile(session, entry->Ops, {}, entry->FinalLastPS);
+        return;
+    }
+
+    CountTile(_misses);
+
+    // Record the tile, then replay the recording so misses and hits produce their paint structs the same way.
+    auto& recording = _recording;
+    recording.Begin(session);
+    session.TileRecording = &recording;
+    PaintTileElements(session, firstElement);
+    session.TileRecording = nullptr;
+    recording.End(session);
+
+    session.LastPS = recording.StartLastPS;
+    session.LastAttachedPS = recording.StartLastAttachedPS;
+    PaintSessionReplayTile(session, recording.Ops, recording.External, recording.FinalLastPS);
+
+    auto newEntry = std::make_shared<TileCacheEntry>();
+    newEntry->Version = *version;
+    newEntry->Uncacheable = !recording.Storable;
+    if (recording.Storable)
+    {
+        newEntry->Ops = recording.Ops;
+        newEntry->EndState = recording.EndState;
+        newEntry->FinalLastPS = recording.FinalLastPS;
+    }
+    StoreEntry(shard, key, std::move(newEntry));
+}
+
+void PaintTileCacheBeginView(int32_t viewWidth, int32_t viewHeight)
+{
+    // Each 32 pixel wide column of the view paints two tiles per 32 pixels of height, plus the rows below the view
+    // whose elements can reach into it.
+    const auto numTiles = static_cast<size_t>(std::max(viewWidth, 0) / 32 + 1) * 2
+        * static_cast<size_t>((std::max(viewHeight, 0) + 2128) / 32);
+    _viewFits.store(numTiles <= kMaxEntries, std::memory_order_relaxed);
+    if (numTiles <= kMaxEntries)
+    {
+        // Room for the whole view and a quarter more, the tiles do not spread over the shards perfectly evenly.
+        const auto entriesPerShard = std::min((numTiles + numTiles / 4) / kNumShards + 1, kMaxEntries / kNumShards);
+        if (entriesPerShard > _entriesPerShard.load(std::memory_order_relaxed))
+        {
+            _entriesPerShard.store(entriesPerShard, std::memory_order_relaxed);
+        }
+    }
+}
+
+void PaintTileCacheSetEnabled(bool enabled)
+{
+    _enabled = enabled;
+    PaintTileCacheInvalidate();
+}
+
+void PaintTileCacheSetStatsEnabled(bool enabled)
+{
+    _statsEnabled = enabled;
+    PaintTileCacheTakeStats();
+}
+
+PaintTileCacheStats PaintTileCacheTakeStats()
+{
+    return {
+        _hits.exchange(0, std::memory_order_relaxed),
+        _misses.exchange(0, std::memory_order_relaxed),
+        _bypassed.exchange(0, std::memory_order_relaxed),
+    };
+}
+
+void PaintTileCacheInvalidate()
+{
+    for (auto& shard : _shards)
+    {
+        std::unique_lock lock(shard.Mutex);
+        shard.Index.clear();
+        shard.Slots.clear();
+        shard.Hand = 0;
+    }
+    _entriesPerShard.store(kMinEntriesPerShard, std::memory_order_relaxed);
+}
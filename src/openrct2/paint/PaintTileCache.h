@@ -0,0 +1,130 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2025 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "Paint.h"
+
+#include <cstdint>
+#include <vector>
+
+struct TileElement;
+
+enum class PaintTileOpType : uint8_t
+{
+    Parent,
+    Child,
+    Orphan,
+    AttachToPS,
+    AttachToAttached,
+};
+
+// Index value for PaintTileOp::LastPS when session.LastPS was null.
+constexpr int16_t kPaintTileOpNone = -1;
+// Final LastPS value of a recording that never replaced session.LastPS.
+constexpr int16_t kPaintTileOpUnchanged = INT16_MAX;
+
+/**
+ * A paint call made while painting the elements of a tile, along with the paint struct it produced before any culling
+ * against the session's DPI. Replaying the ops against another DPI gives the same result as calling the paint functions
+ * again, including how children and attachments are redirected when their parent is culled.
+ */
+struct PaintTileOp
+{
+    PaintStructBoundBox Bounds;
+    const TileElement* Element;
+    ImageId Image;
+    ImageId ColourImage;
+    // Screen position for paint structs, relative position for attachments.
+    ScreenCoordsXY ScreenPos;
+    CoordsXY MapPos;
+    // Op that created the paint struct session.LastPS pointed at when the call was made. Values below
+    // kPaintTileOpNone index the recording's external paint structs.
+    int16_t LastPS;
+    PaintTileOpType Type;
+    ViewportInteractionItem InteractionItem;
+    bool HasImage;
+    bool IsMasked;
+};
+
+/**
+ * Session state left behind by the tile's paint functions that later paint calls of the same column can observe.
+ */
+struct PaintTileEndState
+{
+    const SurfaceElement* Surface;
+    TileElement* CurrentlyDrawnTileElement;
+    CoordsXY SpritePosition;
+    uint16_t WaterHeight;
+    uint8_t Flags;
+    ViewportInteractionItem InteractionType;
+};
+
+struct PaintTileRecording
+{
+    std::vector<PaintTileOp> Ops;
+    // The paint struct or attachment allocated for each op while recording, nullptr if there was no image.
+    std::vector<void*> Allocated;
+    // Paint structs from outside the tile that were observed through session.LastPS.
+    std::vector<PaintStruct*> External;
+    PaintStruct* StartLastPS{};
+    AttachedPaintStruct* StartLastAttachedPS{};
+    PaintTileEndState EndState{};
+    int16_t FinalLastPS = kPaintTileOpNone;
+    bool HasParent{};
+    // False if the ops depend on state from outside the tile, they can then only be replayed into the same session.
+    bool Storable = true;
+
+    void Begin(const PaintSession& session);
+    void End(const PaintSession& session);
+
+    // Called whenever a paint call reads session.LastPS or session.LastAttachedPS.
+    void Observe();
+    void AddStruct(PaintTileOpType type, const PaintStruct* lastPS, const PaintStruct* ps);
+    void AddAttached(PaintTileOpType type, const PaintStruct* lastPS, const AttachedPaintStruct* ps);
+
+private:
+    int16_t IndexOf(const PaintStruct* ps);
+};
+
+void PaintSessionReplayTile(
+    PaintSession& session, const std::vector<PaintTileOp>& ops, const std::vector<PaintStruct*>& external,
+    int16_t finalLastPS);
+
+/**
+ * Paints the elements of a tile, reusing the paint calls from the last time the tile was painted with the same view
+ * settings if none of its elements (or the surfaces around it) have changed since. Falls back to painting the
+ * elements directly when the tile or the current view depends on state the cache does not track.
+ */
+void PaintTileCachePaint(PaintSession& session, TileElement* firstElement, bool partOfVirtualFloor);
+
+/**
+ * Sizes the cache for a view of the given size in world pixels, called before the view is painted. Views too big for
+ * the cache to hold one frame's worth of tiles are painted without it.
+ */
+void PaintTileCacheBeginView(int32_t viewWidth, int32_t viewHeight);
+
+// For comparing the output and cost of painting with and without the cache.
+void PaintTileCacheSetEnabled(bool enabled);
+
+struct PaintTileCacheStats
+{
+    // Tiles replayed from the cache.
+    uint64_t Hits;
+    // Tiles painted and recorded because the cache had no entry, or an outdated one.
+    uint64_t Misses;
+    // Tiles painted without the cache, because the tile, view or session cannot be cached.
+    uint64_t Bypassed;
+};
+
+// Counting is off by default so the paint threads do not share counters, benchgfx turns it on.
+void PaintTileCacheSetStatsEnabled(bool enabled);
+PaintTileCacheStats PaintTileCacheTakeStats();
+
+void PaintTileCacheInvalidate();
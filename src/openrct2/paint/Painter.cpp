@@ -162,6 +162,17 @@ PaintSession* Painter::CreateSession(DrawPixelInfo& dpi, uint32_t viewFlags, uin
     {
         // Create new one in pool.
         session = &_paintSessionPool.emplace_back();
+        std::fill(std::begin(session->Quadrants), std::end(session->Quadrants), nullptr);
+        session->QuadrantBackIndex = std::numeric_limits<uint32_t>::max();
+        session->QuadrantFrontIndex = 0;
+    }
+
+    // Only the quadrants the session used last time can be non-null, so only that range needs clearing instead of
+    // all MaxPaintQuadrants entries.
+    if (session->QuadrantBackIndex <= session->QuadrantFrontIndex)
+    {
+        std::fill(
+            session->Quadrants + session->QuadrantBackIndex, session->Quadrants + session->QuadrantFrontIndex + 1, nullptr);
     }
 
     session->DPI = dpi;
@@ -171,13 +182,13 @@ PaintSession* Painter::CreateSession(DrawPixelInfo& dpi, uint32_t viewFlags, uin
     session->Flags = 0;
     session->CurrentRotation = rotation;
 
-    std::fill(std::begin(session->Quadrants), std::end(session->Quadrants), nullptr);
     session->PaintHead = nullptr;
     session->LastPS = nullptr;
     session->LastAttachedPS = nullptr;
     session->PSStringHead = nullptr;
     session->LastPSString = nullptr;
     session->WoodenSupportsPrependTo = nullptr;
+    session->TileRecording = nullptr;
     session->CurrentlyDrawnEntity = nullptr;
     session->CurrentlyDrawnTileElement = nullptr;
     session->Surface = nullptr;
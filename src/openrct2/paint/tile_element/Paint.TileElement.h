@@ -39,6 +39,7 @@ void PaintUtilSetSegmentSupportHeight(PaintSession& session, int32_t segments, u
 uint16_t PaintUtilRotateSegments(uint16_t segments, uint8_t rotation);
 
 void TileElementPaintSetup(PaintSession& session, const CoordsXY& mapCoords, bool isTrackPiecePreview = false);
+void PaintTileElements(PaintSession& session, TileElement* tileElement);
 
 void PaintEntrance(PaintSession& session, uint8_t direction, int32_t height, const EntranceElement& entranceElement);
 void PaintBanner(PaintSession& session, uint8_t direction, int32_t height, const BannerElement& bannerElement);
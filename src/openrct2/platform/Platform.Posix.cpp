@@ -27,6 +27,7 @@
     #include <fnmatch.h>
     #include <locale>
     #include <pwd.h>
+    #include <sys/resource.h>
     #include <sys/stat.h>
     #include <sys/time.h>
     #include <unistd.h>
@@ -365,6 +366,21 @@ namespace OpenRCT2::Platform
         datetime64 utcNow = epochAsTicks + utcEpochTicks;
         return utcNow;
     }
+
+    uint64_t GetPeakMemoryUsage()
+    {
+        struct rusage usage;
+        if (getrusage(RUSAGE_SELF, &usage) != 0)
+        {
+            return 0;
+        }
+    #if defined(__APPLE__)
+        // macOS reports bytes, everything else reports kilobytes
+        return static_cast<uint64_t>(usage.ru_maxrss);
+    #else
+        return static_cast<uint64_t>(usage.ru_maxrss) * 1024;
+    #endif
+    }
 } // namespace OpenRCT2::Platform
 
 #endif
@@ -24,6 +24,7 @@
     #include <datetimeapi.h>
     #include <lmcons.h>
     #include <memory>
+    #include <psapi.h>
     #include <shlobj.h>
     #undef GetEnvironmentVariable
 
@@ -841,6 +842,16 @@ namespace OpenRCT2::Platform
         return utcNow;
     }
 
+    uint64_t GetPeakMemoryUsage()
+    {
+        PROCESS_MEMORY_COUNTERS counters{};
+        if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        {
+            return 0;
+        }
+        return static_cast<uint64_t>(counters.PeakWorkingSetSize);
+    }
+
     bool SetupUriProtocol()
     {
         LOG_VERBOSE("Setting up URI protocol...");
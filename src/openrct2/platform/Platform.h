@@ -127,6 +127,9 @@ namespace OpenRCT2::Platform
     datetime64 GetDatetimeNowUTC();
     uint32_t GetTicks();
 
+    // Returns the peak resident memory of the current process in bytes, or 0 if it cannot be determined.
+    uint64_t GetPeakMemoryUsage();
+
     void Sleep(uint32_t ms);
 
     bool SSE41Available();
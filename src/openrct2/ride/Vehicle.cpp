@@ -612,6 +612,9 @@ void VehicleUpdateAll()
     if ((gScreenFlags & SCREEN_FLAGS_TRACK_DESIGNER) && GetGameState().EditorStep != EditorStep::RollercoasterDesigner)
         return;
 
+    // Every train is updated every tick, including ones waiting in a station: waiting trains still advance
+    // time_waiting, restraint and door animations and sound state each tick, so none of them can be skipped without
+    // changing game state.
     for (auto vehicle : TrainManager::View())
     {
         vehicle->Update();
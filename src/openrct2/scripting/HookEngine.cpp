@@ -14,6 +14,7 @@
     #include "../core/EnumMap.hpp"
     #include "ScriptEngine.h"
 
+    #include <algorithm>
     #include <unordered_map>
 
 using namespace OpenRCT2::Scripting;
@@ -43,6 +44,15 @@ HOOK_TYPE OpenRCT2::Scripting::GetHookType(const std::string& name)
     return (result != HooksLookupTable.end()) ? result->second : HOOK_TYPE::UNDEFINED;
 }
 
+bool HookFilter::Matches(std::string_view action, int32_t player) const
+{
+    if (!Actions.empty() && std::find(Actions.begin(), Actions.end(), action) == Actions.end())
+        return false;
+    if (!Players.empty() && std::find(Players.begin(), Players.end(), player) == Players.end())
+        return false;
+    return true;
+}
+
 HookEngine::HookEngine(ScriptEngine& scriptEngine)
     : _scriptEngine(scriptEngine)
 {
@@ -53,11 +63,11 @@ HookEngine::HookEngine(ScriptEngine& scriptEngine)
     }
 }
 
-uint32_t HookEngine::Subscribe(HOOK_TYPE type, std::shared_ptr<Plugin> owner, const DukValue& function)
+uint32_t HookEngine::Subscribe(HOOK_TYPE type, std::shared_ptr<Plugin> owner, const DukValue& function, HookFilter filter)
 {
     auto& hookList = GetHookList(type);
     auto cookie = _nextCookie++;
-    hookList.Hooks.emplace_back(cookie, owner, function);
+    hookList.Hooks.emplace_back(cookie, owner, function, std::move(filter));
     return cookie;
 }
 
@@ -100,6 +110,13 @@ bool HookEngine::HasSubscriptions(HOOK_TYPE type) const
     return !hookList.Hooks.empty();
 }
 
+bool HookEngine::HasSubscriptions(HOOK_TYPE type, std::string_view action, int32_t player) const
+{
+    auto& hookList = GetHookList(type);
+    return std::any_of(
+        hookList.Hooks.begin(), hookList.Hooks.end(), [&](const Hook& hook) { return hook.Filter.Matches(action, player); });
+}
+
 bool HookEngine::IsValidHookForPlugin(HOOK_TYPE type, Plugin& plugin) const
 {
     if (type == HOOK_TYPE::MAP_CHANGED && plugin.GetMetadata().Type != PluginType::Intransient)
@@ -112,18 +129,33 @@ bool HookEngine::IsValidHookForPlugin(HOOK_TYPE type, Plugin& plugin) const
 void HookEngine::Call(HOOK_TYPE type, bool isGameStateMutable)
 {
     auto& hookList = GetHookList(type);
+    const auto hookName = HooksLookupTable[type];
     for (auto& hook : hookList.Hooks)
     {
-        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, {}, isGameStateMutable);
+        _scriptEngine.ExecuteTimedPluginCall(hookName, hook.Owner, hook.Function, {}, isGameStateMutable);
     }
 }
 
 void HookEngine::Call(HOOK_TYPE type, const DukValue& arg, bool isGameStateMutable)
 {
     auto& hookList = GetHookList(type);
+    const auto hookName = HooksLookupTable[type];
     for (auto& hook : hookList.Hooks)
     {
-        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, { arg }, isGameStateMutable);
+        _scriptEngine.ExecuteTimedPluginCall(hookName, hook.Owner, hook.Function, { arg }, isGameStateMutable);
+    }
+}
+
+void HookEngine::Call(HOOK_TYPE type, std::string_view action, int32_t player, const DukValue& arg, bool isGameStateMutable)
+{
+    auto& hookList = GetHookList(type);
+    const auto hookName = HooksLookupTable[type];
+    for (auto& hook : hookList.Hooks)
+    {
+        if (hook.Filter.Matches(action, player))
+        {
+            _scriptEngine.ExecuteTimedPluginCall(hookName, hook.Owner, hook.Function, { arg }, isGameStateMutable);
+        }
     }
 }
 
@@ -131,6 +163,7 @@ void HookEngine::Call(
     HOOK_TYPE type, const std::initializer_list<std::pair<std::string_view, std::any>>& args, bool isGameStateMutable)
 {
     auto& hookList = GetHookList(type);
+    const auto hookName = HooksLookupTable[type];
     for (auto& hook : hookList.Hooks)
     {
         auto ctx = _scriptEngine.GetContext();
@@ -158,7 +191,7 @@ void HookEngine::Call(
 
         std::vector<DukValue> dukArgs;
         dukArgs.push_back(DukValue::take_from_stack(ctx));
-        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, dukArgs, isGameStateMutable);
+        _scriptEngine.ExecuteTimedPluginCall(hookName, hook.Owner, hook.Function, dukArgs, isGameStateMutable);
     }
 }
 
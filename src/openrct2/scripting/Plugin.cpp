@@ -11,17 +11,252 @@
 
     #include "Plugin.h"
 
+    #include "../Context.h"
     #include "../Diagnostic.h"
     #include "../OpenRCT2.h"
+    #include "../PlatformEnvironment.h"
+    #include "../Version.h"
+    #include "../config/Config.h"
+    #include "../core/Crypt.h"
     #include "../core/File.h"
+    #include "../core/FileScanner.h"
+    #include "../core/Path.hpp"
     #include "Duktape.hpp"
     #include "ScriptEngine.h"
 
+    #include <cstdio>
+    #include <cstring>
     #include <fstream>
     #include <memory>
+    #include <random>
+    #include <unordered_set>
+    #include <utility>
 
+using namespace OpenRCT2;
 using namespace OpenRCT2::Scripting;
 
+/*
+ * Compiled plug-ins can be cached in <cache>/plugin as Duktape bytecode, one file per plug-in path. Duktape does not
+ * validate bytecode, so loading a crafted file can do anything the game process can, not just what a plug-in can. The
+ * cache is therefore off unless enabled in the config, and every file is signed with a keyed SHA-256 so only files
+ * written by this install are loaded. The key is random and kept in the config directory. Plug-ins have no way to write
+ * files, but anything that can write to the config directory can also replace the key, so the cache is only as
+ * trustworthy as the user's own directories. Builds without networking lack SHA-256 and never use the cache.
+ */
+static constexpr uint32_t kBytecodeCacheMagic = 0x43424A53; // SJBC
+static constexpr uint32_t kBytecodeCacheVersion = 2;
+static constexpr size_t kBytecodeCacheKeySize = 32;
+
+struct BytecodeCacheHeader
+{
+    uint32_t Magic{};
+    uint32_t Version{};
+    uint32_t EngineVersion{};
+    uint32_t Size{};
+    Crypt::FNV1aAlgorithm::Result SourceHash{};
+    // Keyed hash of the header (with this field zeroed) and the bytecode.
+    Crypt::Sha256Algorithm::Result Signature{};
+};
+
+static bool isBytecodeCacheEnabled()
+{
+    #ifdef DISABLE_NETWORK
+    return false;
+    #else
+    return Config::Get().plugin.EnableBytecodeCache;
+    #endif
+}
+
+static Crypt::FNV1aAlgorithm::Result getSourceHash(std::string_view code)
+{
+    // Include the build so that a cache from a different build is never loaded.
+    auto fnv1a = Crypt::CreateFNV1a();
+    fnv1a->Update(gVersionInfoFull, std::strlen(gVersionInfoFull));
+    fnv1a->Update(code.data(), code.size());
+    return fnv1a->Finish();
+}
+
+static u8string getBytecodeCacheDirectory()
+{
+    auto env = GetContext()->GetPlatformEnvironment();
+    return Path::Combine(env->GetDirectoryPath(DIRBASE::CACHE), u8"plugin");
+}
+
+static u8string getBytecodeCacheFileName(std::string_view pluginPath)
+{
+    auto pathHash = Crypt::FNV1a(pluginPath.data(), pluginPath.size());
+    char fileName[32]{};
+    for (size_t i = 0; i < pathHash.size(); i++)
+    {
+        std::snprintf(fileName + (i * 2), 3, "%02x", pathHash[i]);
+    }
+    return std::string(fileName) + ".jsc";
+}
+
+    #ifndef DISABLE_NETWORK
+static u8string getBytecodeCachePath(std::string_view pluginPath)
+{
+    return Path::Combine(getBytecodeCacheDirectory(), getBytecodeCacheFileName(pluginPath));
+}
+
+// Reads the signing key, creating it the first time. A key that cannot be saved is still used for this session.
+static const std::vector<uint8_t>& getBytecodeCacheKey()
+{
+    static std::vector<uint8_t> key;
+    if (!key.empty())
+        return key;
+
+    auto env = GetContext()->GetPlatformEnvironment();
+    auto keyPath = Path::Combine(env->GetDirectoryPath(DIRBASE::CONFIG), u8"plugin_cache.key");
+    try
+    {
+        if (File::Exists(keyPath))
+        {
+            key = File::ReadAllBytes(keyPath);
+            if (key.size() == kBytecodeCacheKeySize)
+                return key;
+        }
+    }
+    catch (const std::exception& e)
+    {
+        LOG_VERBOSE("Unable to read plug-in bytecode cache key: %s", e.what());
+    }
+
+    std::random_device device;
+    key.resize(kBytecodeCacheKeySize);
+    for (auto& value : key)
+    {
+        value = static_cast<uint8_t>(device());
+    }
+    try
+    {
+        File::WriteAllBytes(keyPath, key.data(), key.size());
+    }
+    catch (const std::exception& e)
+    {
+        LOG_VERBOSE("Unable to write plug-in bytecode cache key: %s", e.what());
+    }
+    return key;
+}
+
+static Crypt::Sha256Algorithm::Result getBytecodeSignature(BytecodeCacheHeader header, const uint8_t* bytecode)
+{
+    const auto& key = getBytecodeCacheKey();
+    header.Signature = {};
+    auto sha256 = Crypt::CreateSHA256();
+    sha256->Update(key.data(), key.size());
+    sha256->Update(&header, sizeof(header));
+    sha256->Update(bytecode, header.Size);
+    return sha256->Finish();
+}
+    #endif
+
+// Pushes the cached compiled function for the given plug-in, returns false if there is no valid cache.
+static bool loadBytecodeFromCache(
+    duk_context* ctx, std::string_view pluginPath, const Crypt::FNV1aAlgorithm::Result& sourceHash)
+{
+    #ifdef DISABLE_NETWORK
+    return false;
+    #else
+    try
+    {
+        auto cachePath = getBytecodeCachePath(pluginPath);
+        if (!File::Exists(cachePath))
+            return false;
+
+        auto data = File::ReadAllBytes(cachePath);
+        BytecodeCacheHeader header;
+        if (data.size() < sizeof(header))
+        {
+            File::Delete(cachePath);
+            return false;
+        }
+
+        std::memcpy(&header, data.data(), sizeof(header));
+        const auto* bytecode = data.data() + sizeof(header);
+        if (header.Magic != kBytecodeCacheMagic || header.Version != kBytecodeCacheVersion
+            || header.EngineVersion != DUK_VERSION || header.SourceHash != sourceHash
+            || header.Size != data.size() - sizeof(header) || header.Signature != getBytecodeSignature(header, bytecode))
+        {
+            // Stale or not written by this install, it is replaced once the plug-in is compiled.
+            File::Delete(cachePath);
+            return false;
+        }
+
+        auto* buffer = duk_push_fixed_buffer(ctx, header.Size);
+        std::memcpy(buffer, bytecode, header.Size);
+        duk_load_function(ctx);
+        return true;
+    }
+    catch (const std::exception& e)
+    {
+        LOG_VERBOSE("Unable to read plug-in bytecode cache: %s", e.what());
+        return false;
+    }
+    #endif
+}
+
+// Writes the compiled function on top of the stack to the cache, leaving the stack unchanged.
+static void saveBytecodeToCache(duk_context* ctx, std::string_view pluginPath, const Crypt::FNV1aAlgorithm::Result& sourceHash)
+{
+    #ifndef DISABLE_NETWORK
+    duk_dup(ctx, -1);
+    duk_dump_function(ctx);
+    duk_size_t size{};
+    const auto* bytecode = static_cast<const uint8_t*>(duk_get_buffer(ctx, -1, &size));
+
+    try
+    {
+        BytecodeCacheHeader header;
+        header.Magic = kBytecodeCacheMagic;
+        header.Version = kBytecodeCacheVersion;
+        header.EngineVersion = DUK_VERSION;
+        header.Size = static_cast<uint32_t>(size);
+        header.SourceHash = sourceHash;
+        header.Signature = getBytecodeSignature(header, bytecode);
+
+        std::vector<uint8_t> data(sizeof(header) + size);
+        std::memcpy(data.data(), &header, sizeof(header));
+        std::memcpy(data.data() + sizeof(header), bytecode, size);
+
+        auto cachePath = getBytecodeCachePath(pluginPath);
+        Path::CreateDirectory(Path::GetDirectory(cachePath));
+        File::WriteAllBytes(cachePath, data.data(), data.size());
+    }
+    catch (const std::exception& e)
+    {
+        LOG_VERBOSE("Unable to write plug-in bytecode cache: %s", e.what());
+    }
+    duk_pop(ctx);
+    #endif
+}
+
+void Plugin::PruneBytecodeCache(const std::vector<std::string>& pluginPaths)
+{
+    const auto directory = getBytecodeCacheDirectory();
+    if (!Path::DirectoryExists(directory))
+        return;
+
+    std::unordered_set<u8string> keep;
+    if (isBytecodeCacheEnabled())
+    {
+        for (const auto& path : pluginPaths)
+        {
+            keep.insert(getBytecodeCacheFileName(path));
+        }
+    }
+
+    auto scanner = Path::ScanDirectory(Path::Combine(directory, u8"*.jsc"), false);
+    while (scanner->Next())
+    {
+        const auto& path = scanner->GetPath();
+        if (keep.find(Path::GetFileName(path)) == keep.end())
+        {
+            File::Delete(path);
+        }
+    }
+}
+
 Plugin::Plugin(duk_context* context, std::string_view path)
     : _context(context)
     , _path(path)
@@ -62,8 +297,27 @@ void Plugin::Load()
         "     })(" + projectedVariables + ");";
     // clang-format on
 
-    auto flags = DUK_COMPILE_EVAL | DUK_COMPILE_SAFE | DUK_COMPILE_NOSOURCE | DUK_COMPILE_NOFILENAME;
-    auto result = duk_eval_raw(_context, code.c_str(), code.size(), flags);
+    // Plug-ins loaded from a file skip compilation if their bytecode is cached. This is equivalent to duk_eval_raw.
+    const bool useCache = HasPath() && isBytecodeCacheEnabled();
+    const auto sourceHash = useCache ? getSourceHash(code) : Crypt::FNV1aAlgorithm::Result{};
+    if (!useCache || !loadBytecodeFromCache(_context, _path, sourceHash))
+    {
+        auto flags = DUK_COMPILE_EVAL | DUK_COMPILE_SAFE | DUK_COMPILE_NOSOURCE | DUK_COMPILE_NOFILENAME;
+        auto result = duk_compile_raw(_context, code.c_str(), code.size(), flags);
+        if (result != DUK_ERR_NONE)
+        {
+            auto val = std::string(duk_safe_to_string(_context, -1));
+            duk_pop(_context);
+            throw std::runtime_error("Failed to load plug-in script: " + val + " at " + _path);
+        }
+        if (useCache)
+        {
+            saveBytecodeToCache(_context, _path, sourceHash);
+        }
+    }
+
+    duk_push_global_object(_context);
+    auto result = duk_pcall_method(_context, 0);
     if (result != DUK_ERR_NONE)
     {
         auto val = std::string(duk_safe_to_string(_context, -1));
@@ -224,4 +478,25 @@ bool Plugin::IsTransient() const
     return _metadata.Type != PluginType::Intransient;
 }
 
+PluginCallStats& Plugin::GetCallStats(std::string_view name)
+{
+    auto it = _callStats.find(name);
+    if (it == _callStats.end())
+    {
+        it = _callStats.emplace(std::string(name), PluginCallStats{}).first;
+    }
+    return it->second;
+}
+
+void Plugin::ResetCallStats()
+{
+    _callStats.clear();
+    _hasExceededTimeBudget = false;
+}
+
+bool Plugin::MarkTimeBudgetExceeded()
+{
+    return !std::exchange(_hasExceededTimeBudget, true);
+}
+
 #endif
@@ -13,6 +13,8 @@
 
     #include "Duktape.hpp"
 
+    #include <algorithm>
+    #include <map>
     #include <memory>
     #include <string>
     #include <string_view>
@@ -52,6 +54,22 @@ namespace OpenRCT2::Scripting
         DukValue Main;
     };
 
+    // Time spent running a plug-in's callbacks for one hook or for its intervals, in microseconds.
+    struct PluginCallStats
+    {
+        uint32_t CallCount{};
+        uint32_t DeferredCount{};
+        double TotalTime{};
+        double MaxTime{};
+
+        void Record(double time)
+        {
+            CallCount++;
+            TotalTime += time;
+            MaxTime = std::max(MaxTime, time);
+        }
+    };
+
     class Plugin
     {
     private:
@@ -62,6 +80,8 @@ namespace OpenRCT2::Scripting
         bool _hasLoaded{};
         bool _hasStarted{};
         bool _isStopping{};
+        bool _hasExceededTimeBudget{};
+        std::map<std::string, PluginCallStats, std::less<>> _callStats;
 
     public:
         std::string_view GetPath() const
@@ -101,6 +121,17 @@ namespace OpenRCT2::Scripting
 
         int32_t GetTargetAPIVersion() const;
 
+        const std::map<std::string, PluginCallStats, std::less<>>& GetCallStats() const
+        {
+            return _callStats;
+        }
+
+        PluginCallStats& GetCallStats(std::string_view name);
+        void ResetCallStats();
+
+        // Returns true only the first time the time budget is exceeded since the stats were reset.
+        bool MarkTimeBudgetExceeded();
+
         Plugin() = default;
         Plugin(duk_context* context, std::string_view path);
         Plugin(const Plugin&) = delete;
@@ -117,6 +148,9 @@ namespace OpenRCT2::Scripting
 
         bool IsTransient() const;
 
+        // Deletes cached bytecode of plug-ins not in the list, or all of it when the cache is disabled.
+        static void PruneBytecodeCache(const std::vector<std::string>& pluginPaths);
+
     private:
         void LoadCodeFromFile();
 
@@ -60,6 +60,7 @@
     #include "bindings/world/ScTileElement.hpp"
 
     #include <cassert>
+    #include <chrono>
     #include <iostream>
     #include <memory>
     #include <stdexcept>
@@ -581,6 +582,8 @@ void ScriptEngine::RefreshPlugins()
         RegisterPlugin(plugin);
     }
 
+    Plugin::PruneBytecodeCache(pluginFiles);
+
     // Turn on hot reload if not already enabled
     if (!_hotReloadingInitialised && Config::Get().plugin.EnableHotReloading && NetworkGetMode() == NETWORK_MODE_NONE)
     {
@@ -1019,6 +1022,26 @@ DukValue ScriptEngine::ExecutePluginCall(
     return DukValue();
 }
 
+double ScriptEngine::ExecuteTimedPluginCall(
+    std::string_view name, std::shared_ptr<Plugin> plugin, const DukValue& func, const std::vector<DukValue>& args,
+    bool isGameStateMutable)
+{
+    const auto startTime = std::chrono::steady_clock::now();
+    ExecutePluginCall(plugin, func, args, isGameStateMutable);
+    const auto time = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - startTime).count();
+    plugin->GetCallStats(name).Record(time);
+
+    const auto timeBudget = Config::Get().plugin.TimeBudget;
+    if (timeBudget > 0 && time > timeBudget * 1000.0 && plugin->MarkTimeBudgetExceeded())
+    {
+        LogPluginInfo(
+            plugin,
+            "'" + std::string(name) + "' took " + std::to_string(static_cast<int32_t>(time / 1000.0))
+                + " ms, exceeding the time budget of " + std::to_string(timeBudget) + " ms.");
+    }
+    return time;
+}
+
 void ScriptEngine::LogPluginInfo(std::string_view message)
 {
     auto plugin = _execInfo.GetCurrentPlugin();
@@ -1461,15 +1484,24 @@ void ScriptEngine::RunGameActionHooks(const GameAction& action, GameActions::Res
     DukStackFrame frame(_context);
 
     auto hookType = isExecute ? HOOK_TYPE::ACTION_EXECUTE : HOOK_TYPE::ACTION_QUERY;
-    if (_hookEngine.HasSubscriptions(hookType))
+    if (!_hookEngine.HasSubscriptions(hookType))
+    {
+        return;
+    }
+
+    // Only build the event arguments if a hook is interested in this action.
+    auto actionId = action.GetType();
+    const auto actionName = actionId == GameCommand::Custom ? static_cast<const CustomAction&>(action).GetId()
+                                                            : GetActionName(actionId);
+    const auto player = action.GetPlayer().id;
+    if (_hookEngine.HasSubscriptions(hookType, actionName, player))
     {
         DukObject obj(_context);
 
-        auto actionId = action.GetType();
-        if (action.GetType() == GameCommand::Custom)
+        if (actionId == GameCommand::Custom)
         {
-            auto customAction = static_cast<const CustomAction&>(action);
-            obj.Set("action", customAction.GetId());
+            const auto& customAction = static_cast<const CustomAction&>(action);
+            obj.Set("action", actionName);
 
             auto dukArgs = DuktapeTryParseJson(_context, customAction.GetJson());
             if (dukArgs)
@@ -1484,7 +1516,6 @@ void ScriptEngine::RunGameActionHooks(const GameAction& action, GameActions::Res
         }
         else
         {
-            auto actionName = GetActionName(actionId);
             if (!actionName.empty())
             {
                 obj.Set("action", actionName);
@@ -1506,7 +1537,7 @@ void ScriptEngine::RunGameActionHooks(const GameAction& action, GameActions::Res
         obj.Set("result", GameActionResultToDuk(action, result));
         auto dukEventArgs = obj.Take();
 
-        _hookEngine.Call(hookType, dukEventArgs, false);
+        _hookEngine.Call(hookType, actionName, player, dukEventArgs, false);
 
         if (!isExecute)
         {
@@ -1706,6 +1737,11 @@ void ScriptEngine::UpdateIntervals()
         }
     }
 
+    // Time spent in each plug-in's intervals during this update. Once a plug-in exceeds the time budget its
+    // remaining intervals are deferred to the next update, which is safe as intervals can not modify the game state.
+    const auto timeBudget = Config::Get().plugin.TimeBudget * 1000.0;
+    std::unordered_map<const Plugin*, double> timeSpent;
+
     // Execute all intervals that are due.
     for (auto it = _intervals.begin(); it != _intervals.end(); it++)
     {
@@ -1722,7 +1758,19 @@ void ScriptEngine::UpdateIntervals()
             continue;
         }
 
-        ExecutePluginCall(interval.Owner, interval.Callback, {}, false);
+        auto owner = interval.Owner;
+        auto& ownerTimeSpent = timeSpent[owner.get()];
+        if (timeBudget > 0 && ownerTimeSpent >= timeBudget)
+        {
+            owner->GetCallStats(kIntervalCallStatsName).DeferredCount++;
+            if (owner->MarkTimeBudgetExceeded())
+            {
+                LogPluginInfo(owner, "Intervals exceeded the time budget, deferring the remaining intervals.");
+            }
+            continue;
+        }
+
+        ownerTimeSpent += ExecuteTimedPluginCall(kIntervalCallStatsName, owner, interval.Callback, {}, false);
 
         interval.LastTimestamp = timestamp;
         if (!interval.Repeat)
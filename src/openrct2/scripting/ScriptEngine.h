@@ -46,7 +46,7 @@ namespace OpenRCT2
 
 namespace OpenRCT2::Scripting
 {
-    static constexpr int32_t kPluginApiVersion = 104;
+    static constexpr int32_t kPluginApiVersion = 107;
 
     // Versions marking breaking changes.
     static constexpr int32_t kApiVersionPeepDeprecation = 33;
@@ -125,6 +125,9 @@ namespace OpenRCT2::Scripting
         }
     };
 
+    // Name under which the time spent in setInterval and setTimeout callbacks is recorded.
+    constexpr std::string_view kIntervalCallStatsName = "interval";
+
     using IntervalHandle = uint32_t;
     struct ScriptInterval
     {
@@ -237,6 +240,12 @@ namespace OpenRCT2::Scripting
             std::shared_ptr<Plugin> plugin, const DukValue& func, const DukValue& thisValue, const std::vector<DukValue>& args,
             bool isGameStateMutable);
 
+        // Runs a plug-in callback, records the time it took under the given hook or interval name and returns the time in
+        // microseconds.
+        double ExecuteTimedPluginCall(
+            std::string_view name, std::shared_ptr<Plugin> plugin, const DukValue& func, const std::vector<DukValue>& args,
+            bool isGameStateMutable);
+
         void LogPluginInfo(std::string_view message);
         void LogPluginInfo(const std::shared_ptr<Plugin>& plugin, std::string_view message);
 
@@ -11,6 +11,7 @@
 
 #ifdef ENABLE_SCRIPTING
 
+    #include "../../../windows/Intent.h"
     #include "ScEntity.hpp"
 
 namespace OpenRCT2::Scripting
@@ -86,9 +87,12 @@ namespace OpenRCT2::Scripting
         {
             ThrowIfGameStateNotMutable();
             auto peep = GetPeep();
-            if (peep != nullptr)
+            if (peep != nullptr && peep->SetName(value))
             {
-                peep->SetName(value);
+                // Same as the rename actions, the lists cache the names they sort by.
+                auto action = peep->Is<Staff>() ? INTENT_ACTION_REFRESH_STAFF_LIST : INTENT_ACTION_INVALIDATE_GUEST_NAMES;
+                auto intent = Intent(action);
+                ContextBroadcastIntent(&intent);
             }
         }
 
@@ -274,14 +274,55 @@ namespace OpenRCT2::Scripting
         __declspec(noinline)
     #endif
         std::shared_ptr<ScDisposable>
-            CreateSubscription(HOOK_TYPE hookType, const DukValue& callback)
+            CreateSubscription(HOOK_TYPE hookType, const DukValue& callback, HookFilter filter)
         {
             auto owner = _execInfo.GetCurrentPlugin();
-            auto cookie = _hookEngine.Subscribe(hookType, owner, callback);
+            auto cookie = _hookEngine.Subscribe(hookType, owner, callback, std::move(filter));
             return std::make_shared<ScDisposable>([this, hookType, cookie]() { _hookEngine.Unsubscribe(hookType, cookie); });
         }
 
-        std::shared_ptr<ScDisposable> subscribe(const std::string& hook, const DukValue& callback)
+        static HookFilter ParseHookFilter(duk_context* ctx, HOOK_TYPE hookType, const DukValue& options)
+        {
+            HookFilter filter;
+            if (options.type() != DukValue::Type::OBJECT)
+            {
+                return filter;
+            }
+
+            if (hookType != HOOK_TYPE::ACTION_QUERY && hookType != HOOK_TYPE::ACTION_EXECUTE)
+            {
+                duk_error(ctx, DUK_ERR_ERROR, "Filter options are only supported for action hooks.");
+            }
+
+            auto actions = options["actions"];
+            if (actions.is_array())
+            {
+                for (const auto& action : actions.as_array())
+                {
+                    if (action.type() != DukValue::Type::STRING)
+                    {
+                        duk_error(ctx, DUK_ERR_ERROR, "Expected string for action filter");
+                    }
+                    filter.Actions.push_back(action.as_string());
+                }
+            }
+
+            auto players = options["players"];
+            if (players.is_array())
+            {
+                for (const auto& player : players.as_array())
+                {
+                    if (player.type() != DukValue::Type::NUMBER)
+                    {
+                        duk_error(ctx, DUK_ERR_ERROR, "Expected number for player filter");
+                    }
+                    filter.Players.push_back(player.as_int());
+                }
+            }
+            return filter;
+        }
+
+        std::shared_ptr<ScDisposable> subscribe(const std::string& hook, const DukValue& callback, const DukValue& options)
         {
             auto& scriptEngine = GetContext()->GetScriptEngine();
             auto ctx = scriptEngine.GetContext();
@@ -308,7 +349,7 @@ namespace OpenRCT2::Scripting
                 duk_error(ctx, DUK_ERR_ERROR, "Hook type not available for this plugin type.");
             }
 
-            return CreateSubscription(hookType, callback);
+            return CreateSubscription(hookType, callback, ParseHookFilter(ctx, hookType, options));
         }
 
         void queryAction(const std::string& action, const DukValue& args, const DukValue& callback)
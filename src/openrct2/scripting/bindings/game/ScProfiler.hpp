@@ -13,6 +13,7 @@
 
     #include "../../../profiling/Profiling.h"
     #include "../../Duktape.hpp"
+    #include "../../ScriptEngine.h"
 
 namespace OpenRCT2::Scripting
 {
@@ -69,6 +70,39 @@ namespace OpenRCT2::Scripting
             return DukValue::take_from_stack(_ctx);
         }
 
+        DukValue getPluginData()
+        {
+            auto& scriptEngine = GetContext()->GetScriptEngine();
+            duk_push_array(_ctx);
+            duk_uarridx_t index = 0;
+            for (const auto& plugin : scriptEngine.GetPlugins())
+            {
+                duk_push_array(_ctx);
+                duk_uarridx_t callIndex = 0;
+                for (const auto& [name, stats] : plugin->GetCallStats())
+                {
+                    DukObject obj(_ctx);
+                    obj.Set("name", name);
+                    obj.Set("callCount", stats.CallCount);
+                    obj.Set("deferredCount", stats.DeferredCount);
+                    obj.Set("maxTime", stats.MaxTime);
+                    obj.Set("totalTime", stats.TotalTime);
+                    obj.Take().push();
+                    duk_put_prop_index(_ctx, /* duk stack index */ -2, callIndex);
+                    callIndex++;
+                }
+                auto calls = DukValue::take_from_stack(_ctx);
+
+                DukObject obj(_ctx);
+                obj.Set("name", plugin->GetMetadata().Name);
+                obj.Set("calls", calls);
+                obj.Take().push();
+                duk_put_prop_index(_ctx, /* duk stack index */ -2, index);
+                index++;
+            }
+            return DukValue::take_from_stack(_ctx);
+        }
+
         void start()
         {
             OpenRCT2::Profiling::Enable();
@@ -82,6 +116,10 @@ namespace OpenRCT2::Scripting
         void reset()
         {
             OpenRCT2::Profiling::ResetData();
+            for (const auto& plugin : GetContext()->GetScriptEngine().GetPlugins())
+            {
+                plugin->ResetCallStats();
+            }
         }
 
         bool enabled_get() const
@@ -93,6 +131,7 @@ namespace OpenRCT2::Scripting
         static void Register(duk_context* ctx)
         {
             dukglue_register_method(ctx, &ScProfiler::getData, "getData");
+            dukglue_register_method(ctx, &ScProfiler::getPluginData, "getPluginData");
             dukglue_register_method(ctx, &ScProfiler::start, "start");
             dukglue_register_method(ctx, &ScProfiler::stop, "stop");
             dukglue_register_method(ctx, &ScProfiler::reset, "reset");
@@ -12,6 +12,7 @@
     #include "ScMap.hpp"
 
     #include "../../../GameState.h"
+    #include "../../../drawing/Drawing.h"
     #include "../../../entity/Balloon.h"
     #include "../../../entity/Duck.h"
     #include "../../../entity/EntityList.h"
@@ -25,7 +26,13 @@
     #include "../../../ride/RideManager.hpp"
     #include "../../../ride/TrainManager.h"
     #include "../../../world/Map.h"
+    #include "../../../world/Park.h"
+    #include "../../../world/tile_element/EntranceElement.h"
+    #include "../../../world/tile_element/PathElement.h"
+    #include "../../../world/tile_element/SurfaceElement.h"
+    #include "../../../world/tile_element/TrackElement.h"
     #include "../../Duktape.hpp"
+    #include "../../ScriptEngine.h"
     #include "../entity/ScEntity.hpp"
     #include "../entity/ScGuest.hpp"
     #include "../entity/ScLitter.hpp"
@@ -36,8 +43,131 @@
     #include "../ride/ScTrackIterator.h"
     #include "../world/ScTile.hpp"
 
+    #include <cstring>
+
 namespace OpenRCT2::Scripting
 {
+    enum : uint32_t
+    {
+        kRegionFieldSurfaceHeight = 1 << 0,
+        kRegionFieldWaterHeight = 1 << 1,
+        kRegionFieldSlope = 1 << 2,
+        kRegionFieldSurfaceStyle = 1 << 3,
+        kRegionFieldOwnership = 1 << 4,
+        kRegionFieldElementType = 1 << 5,
+        kRegionFieldElementBaseHeight = 1 << 6,
+        kRegionFieldElementClearanceHeight = 1 << 7,
+        kRegionFieldElementRide = 1 << 8,
+
+        kRegionFieldsElement = kRegionFieldElementType | kRegionFieldElementBaseHeight | kRegionFieldElementClearanceHeight
+            | kRegionFieldElementRide,
+        kRegionFieldsAll = (1 << 9) - 1,
+    };
+
+    static constexpr std::pair<std::string_view, uint32_t> kRegionFieldNames[] = {
+        { "surfaceHeight", kRegionFieldSurfaceHeight },
+        { "waterHeight", kRegionFieldWaterHeight },
+        { "slope", kRegionFieldSlope },
+        { "surfaceStyle", kRegionFieldSurfaceStyle },
+        { "ownership", kRegionFieldOwnership },
+        { "elementType", kRegionFieldElementType },
+        { "elementBaseHeight", kRegionFieldElementBaseHeight },
+        { "elementClearanceHeight", kRegionFieldElementClearanceHeight },
+        { "elementRide", kRegionFieldElementRide },
+    };
+
+    static constexpr uint16_t kRegionNoRide = 0xFFFF;
+
+    static uint32_t parseRegionFields(duk_context* ctx, const DukValue& options)
+    {
+        if (options.type() != DukValue::Type::OBJECT)
+            return kRegionFieldsAll;
+
+        auto dukFields = options["fields"];
+        if (!dukFields.is_array())
+            return kRegionFieldsAll;
+
+        uint32_t fields = 0;
+        for (const auto& dukField : dukFields.as_array())
+        {
+            auto name = AsOrDefault<std::string>(dukField, "");
+            auto it = std::find_if(std::begin(kRegionFieldNames), std::end(kRegionFieldNames), [&name](const auto& field) {
+                return field.first == name;
+            });
+            if (it == std::end(kRegionFieldNames))
+            {
+                duk_error(ctx, DUK_ERR_ERROR, "Unknown region field: %s", name.c_str());
+            }
+            fields |= it->second;
+        }
+        return fields;
+    }
+
+    // Adds a zero filled typed array of the given length to the object on top of the stack.
+    template<typename T>
+    static T* pushRegionArray(duk_context* ctx, const char* name, size_t length, duk_uint_t type)
+    {
+        auto size = length * sizeof(T);
+        auto* data = static_cast<T*>(duk_push_fixed_buffer(ctx, size));
+        duk_push_buffer_object(ctx, -1, 0, size, type);
+        duk_remove(ctx, -2);
+        duk_put_prop_string(ctx, -2, name);
+        return data;
+    }
+
+    // Returns the data of the named buffer on the region object, or nullptr if it is not set.
+    static const uint8_t* getRegionArray(const DukValue& region, const char* name, size_t length, size_t elementSize)
+    {
+        auto ctx = region.context();
+        region.push();
+        duk_get_prop_string(ctx, -1, name);
+        const uint8_t* result = nullptr;
+        if (duk_is_buffer_data(ctx, -1))
+        {
+            duk_size_t size{};
+            result = static_cast<const uint8_t*>(duk_get_buffer_data(ctx, -1, &size));
+            if (size < length * elementSize)
+            {
+                duk_error(ctx, DUK_ERR_RANGE_ERROR, "Region field '%s' is too small.", name);
+            }
+        }
+        else if (!duk_is_undefined(ctx, -1))
+        {
+            duk_error(ctx, DUK_ERR_TYPE_ERROR, "Region field '%s' must be a typed array.", name);
+        }
+        duk_pop_2(ctx);
+        return result;
+    }
+
+    template<typename T>
+    static T readRegionValue(const uint8_t* data, size_t index)
+    {
+        T value;
+        std::memcpy(&value, data + (index * sizeof(T)), sizeof(T));
+        return value;
+    }
+
+    static uint16_t getElementRide(const TileElement& element)
+    {
+        switch (element.GetType())
+        {
+            case TileElementType::Path:
+            {
+                auto* el = element.AsPath();
+                if (el->IsQueue() && !el->GetRideIndex().IsNull())
+                    return el->GetRideIndex().ToUnderlying();
+                break;
+            }
+            case TileElementType::Track:
+                return element.AsTrack()->GetRideIndex().ToUnderlying();
+            case TileElementType::Entrance:
+                return element.AsEntrance()->GetRideIndex().ToUnderlying();
+            default:
+                break;
+        }
+        return kRegionNoRide;
+    }
+
     ScMap::ScMap(duk_context* ctx)
         : _context(ctx)
     {
@@ -86,6 +216,184 @@ namespace OpenRCT2::Scripting
         return std::make_shared<ScTile>(coords);
     }
 
+    DukValue ScMap::getRegion(int32_t x0, int32_t y0, int32_t x1, int32_t y1, const DukValue& options) const
+    {
+        const auto& mapSize = GetGameState().MapSize;
+        if (x0 < 0 || y0 < 0 || x0 > x1 || y0 > y1 || x1 >= mapSize.x || y1 >= mapSize.y)
+        {
+            duk_error(_context, DUK_ERR_RANGE_ERROR, "Region is outside of the map.");
+        }
+
+        const auto fields = parseRegionFields(_context, options);
+        const auto width = x1 - x0 + 1;
+        const auto height = y1 - y0 + 1;
+        const auto numTiles = static_cast<size_t>(width) * height;
+
+        auto* ctx = _context;
+        duk_push_object(ctx);
+        duk_push_int(ctx, x0);
+        duk_put_prop_string(ctx, -2, "x");
+        duk_push_int(ctx, y0);
+        duk_put_prop_string(ctx, -2, "y");
+        duk_push_int(ctx, width);
+        duk_put_prop_string(ctx, -2, "width");
+        duk_push_int(ctx, height);
+        duk_put_prop_string(ctx, -2, "height");
+
+        if (fields & ~kRegionFieldsElement)
+        {
+            auto* surfaceHeight = (fields & kRegionFieldSurfaceHeight)
+                ? pushRegionArray<uint8_t>(ctx, "surfaceHeight", numTiles, DUK_BUFOBJ_UINT8ARRAY)
+                : nullptr;
+            auto* waterHeight = (fields & kRegionFieldWaterHeight)
+                ? pushRegionArray<uint16_t>(ctx, "waterHeight", numTiles, DUK_BUFOBJ_UINT16ARRAY)
+                : nullptr;
+            auto* slope = (fields & kRegionFieldSlope) ? pushRegionArray<uint8_t>(ctx, "slope", numTiles, DUK_BUFOBJ_UINT8ARRAY)
+                                                       : nullptr;
+            auto* surfaceStyle = (fields & kRegionFieldSurfaceStyle)
+                ? pushRegionArray<uint16_t>(ctx, "surfaceStyle", numTiles, DUK_BUFOBJ_UINT16ARRAY)
+                : nullptr;
+            auto* ownership = (fields & kRegionFieldOwnership)
+                ? pushRegionArray<uint8_t>(ctx, "ownership", numTiles, DUK_BUFOBJ_UINT8ARRAY)
+                : nullptr;
+
+            size_t index = 0;
+            for (int32_t y = y0; y <= y1; y++)
+            {
+                for (int32_t x = x0; x <= x1; x++, index++)
+                {
+                    const auto* surface = MapGetSurfaceElementAt(TileCoordsXY(x, y));
+                    if (surface == nullptr)
+                        continue;
+
+                    if (surfaceHeight != nullptr)
+                        surfaceHeight[index] = surface->BaseHeight;
+                    if (waterHeight != nullptr)
+                        waterHeight[index] = surface->GetWaterHeight();
+                    if (slope != nullptr)
+                        slope[index] = surface->GetSlope();
+                    if (surfaceStyle != nullptr)
+                        surfaceStyle[index] = surface->GetSurfaceObjectIndex();
+                    if (ownership != nullptr)
+                        ownership[index] = surface->GetOwnership();
+                }
+            }
+        }
+
+        if (fields & kRegionFieldsElement)
+        {
+            // Elements of all tiles are packed together, the elements of tile i are at [elementStart[i], elementStart[i + 1]).
+            auto* elementStart = pushRegionArray<uint32_t>(ctx, "elementStart", numTiles + 1, DUK_BUFOBJ_UINT32ARRAY);
+            uint32_t numElements = 0;
+            size_t index = 0;
+            for (int32_t y = y0; y <= y1; y++)
+            {
+                for (int32_t x = x0; x <= x1; x++, index++)
+                {
+                    elementStart[index] = numElements;
+                    const auto* element = MapGetFirstElementAt(TileCoordsXY(x, y));
+                    if (element == nullptr)
+                        continue;
+                    do
+                    {
+                        numElements++;
+                    } while (!(element++)->IsLastForTile());
+                }
+            }
+            elementStart[numTiles] = numElements;
+
+            auto* elementType = (fields & kRegionFieldElementType)
+                ? pushRegionArray<uint8_t>(ctx, "elementType", numElements, DUK_BUFOBJ_UINT8ARRAY)
+                : nullptr;
+            auto* elementBaseHeight = (fields & kRegionFieldElementBaseHeight)
+                ? pushRegionArray<uint8_t>(ctx, "elementBaseHeight", numElements, DUK_BUFOBJ_UINT8ARRAY)
+                : nullptr;
+            auto* elementClearanceHeight = (fields & kRegionFieldElementClearanceHeight)
+                ? pushRegionArray<uint8_t>(ctx, "elementClearanceHeight", numElements, DUK_BUFOBJ_UINT8ARRAY)
+                : nullptr;
+            auto* elementRide = (fields & kRegionFieldElementRide)
+                ? pushRegionArray<uint16_t>(ctx, "elementRide", numElements, DUK_BUFOBJ_UINT16ARRAY)
+                : nullptr;
+
+            size_t elementIndex = 0;
+            for (int32_t y = y0; y <= y1; y++)
+            {
+                for (int32_t x = x0; x <= x1; x++)
+                {
+                    const auto* element = MapGetFirstElementAt(TileCoordsXY(x, y));
+                    if (element == nullptr)
+                        continue;
+                    do
+                    {
+                        if (elementType != nullptr)
+                            elementType[elementIndex] = EnumValue(element->GetType());
+                        if (elementBaseHeight != nullptr)
+                            elementBaseHeight[elementIndex] = element->BaseHeight;
+                        if (elementClearanceHeight != nullptr)
+                            elementClearanceHeight[elementIndex] = element->ClearanceHeight;
+                        if (elementRide != nullptr)
+                            elementRide[elementIndex] = getElementRide(*element);
+                        elementIndex++;
+                    } while (!(element++)->IsLastForTile());
+                }
+            }
+        }
+
+        return DukValue::take_from_stack(ctx);
+    }
+
+    void ScMap::setRegion(const DukValue& region)
+    {
+        ThrowIfGameStateNotMutable();
+        if (region.type() != DukValue::Type::OBJECT)
+        {
+            duk_error(_context, DUK_ERR_TYPE_ERROR, "Expected region object.");
+        }
+
+        const auto x0 = AsOrDefault<int32_t>(region["x"]);
+        const auto y0 = AsOrDefault<int32_t>(region["y"]);
+        const auto width = AsOrDefault<int32_t>(region["width"]);
+        const auto height = AsOrDefault<int32_t>(region["height"]);
+        const auto& mapSize = GetGameState().MapSize;
+        if (x0 < 0 || y0 < 0 || width <= 0 || height <= 0 || x0 + width > mapSize.x || y0 + height > mapSize.y)
+        {
+            duk_error(_context, DUK_ERR_RANGE_ERROR, "Region is outside of the map.");
+        }
+
+        const auto numTiles = static_cast<size_t>(width) * height;
+        const auto* surfaceHeight = getRegionArray(region, "surfaceHeight", numTiles, sizeof(uint8_t));
+        const auto* waterHeight = getRegionArray(region, "waterHeight", numTiles, sizeof(uint16_t));
+        const auto* slope = getRegionArray(region, "slope", numTiles, sizeof(uint8_t));
+        const auto* surfaceStyle = getRegionArray(region, "surfaceStyle", numTiles, sizeof(uint16_t));
+        const auto* ownership = getRegionArray(region, "ownership", numTiles, sizeof(uint8_t));
+
+        size_t index = 0;
+        for (int32_t y = y0; y < y0 + height; y++)
+        {
+            for (int32_t x = x0; x < x0 + width; x++, index++)
+            {
+                auto* surface = MapGetSurfaceElementAt(TileCoordsXY(x, y));
+                if (surface == nullptr)
+                    continue;
+
+                if (surfaceHeight != nullptr)
+                {
+                    surface->BaseHeight = surfaceHeight[index];
+                    surface->ClearanceHeight = surfaceHeight[index];
+                }
+                if (waterHeight != nullptr)
+                    surface->SetWaterHeight(readRegionValue<uint16_t>(waterHeight, index));
+                if (slope != nullptr)
+                    surface->SetSlope(slope[index]);
+                if (surfaceStyle != nullptr)
+                    surface->SetSurfaceObjectIndex(readRegionValue<uint16_t>(surfaceStyle, index));
+                if (ownership != nullptr)
+                    Park::SetTileOwnership(*surface, ownership[index]);
+            }
+        }
+        GfxInvalidateScreen();
+    }
+
     DukValue ScMap::getEntity(int32_t id) const
     {
         if (id >= 0 && id < kMaxEntities)
@@ -387,6 +695,8 @@ namespace OpenRCT2::Scripting
         dukglue_register_property(ctx, &ScMap::rides_get, nullptr, "rides");
         dukglue_register_method(ctx, &ScMap::getRide, "getRide");
         dukglue_register_method(ctx, &ScMap::getTile, "getTile");
+        dukglue_register_method(ctx, &ScMap::getRegion, "getRegion");
+        dukglue_register_method(ctx, &ScMap::setRegion, "setRegion");
         dukglue_register_method(ctx, &ScMap::getEntity, "getEntity");
         dukglue_register_method(ctx, &ScMap::getAllEntities, "getAllEntities");
         dukglue_register_method(ctx, &ScMap::getAllEntitiesOnTile, "getAllEntitiesOnTile");
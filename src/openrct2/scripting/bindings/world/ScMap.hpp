@@ -38,6 +38,10 @@ namespace OpenRCT2::Scripting
 
         std::shared_ptr<ScTile> getTile(int32_t x, int32_t y) const;
 
+        DukValue getRegion(int32_t x0, int32_t y0, int32_t x1, int32_t y1, const DukValue& options) const;
+
+        void setRegion(const DukValue& region);
+
         DukValue getEntity(int32_t id) const;
 
         std::vector<DukValue> getAllEntities(const std::string& type) const;
@@ -17,6 +17,7 @@
     #include "../../../object/LargeSceneryEntry.h"
     #include "../../../ride/Track.h"
     #include "../../../world/Footpath.h"
+    #include "../../../world/Park.h"
     #include "../../../world/Scenery.h"
     #include "../../../world/tile_element/LargeSceneryElement.h"
     #include "../../Duktape.hpp"
@@ -125,6 +126,9 @@ namespace OpenRCT2::Scripting
                     first[numElements - 1].SetLastForTile(true);
                 }
             }
+            MapInvalidateSurfaceElementCache(TileCoordsXY(_coords));
+            // The raw data can change the ownership of the surface.
+            Park::InvalidateOwnedTileCount();
             MapInvalidateTileFull(_coords);
         }
     }
@@ -202,6 +206,10 @@ namespace OpenRCT2::Scripting
             {
                 element->RemoveBannerEntry();
             }
+            if (element->GetType() == TileElementType::Surface)
+            {
+                Park::InvalidateOwnedTileCount();
+            }
             TileElementRemove(&first[index]);
             MapInvalidateTileFull(_coords);
         }
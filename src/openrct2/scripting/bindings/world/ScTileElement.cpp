@@ -20,6 +20,7 @@
     #include "../../../ride/RideData.h"
     #include "../../../ride/Track.h"
     #include "../../../world/Footpath.h"
+    #include "../../../world/Park.h"
     #include "../../../world/Scenery.h"
     #include "../../../world/tile_element/BannerElement.h"
     #include "../../../world/tile_element/EntranceElement.h"
@@ -95,6 +96,8 @@ namespace OpenRCT2::Scripting
             return;
         }
         CreateBannerEntryIfNeeded();
+        Park::InvalidateOwnedTileCount();
+        MapInvalidateSurfaceElementCache(TileCoordsXY(_coords));
         Invalidate();
     }
 
@@ -381,7 +384,7 @@ namespace OpenRCT2::Scripting
             return;
         }
 
-        el->SetOwnership(value);
+        Park::SetTileOwnership(*el, value);
         Invalidate();
     }
 
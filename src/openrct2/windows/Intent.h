@@ -57,6 +57,8 @@ namespace OpenRCT2
         INTENT_ACTION_RESTORE_PROVISIONAL_ELEMENTS,
         INTENT_ACTION_REMOVE_PROVISIONAL_FOOTPATH,
         INTENT_ACTION_REMOVE_PROVISIONAL_TRACK_PIECE,
+        INTENT_ACTION_INVALIDATE_GUEST_NAMES,
+        INTENT_ACTION_REMOVE_GUEST_NAME,
 
         INTENT_ACTION_NULL = 255,
     };
@@ -65,6 +65,7 @@
 #include "tile_element/SurfaceElement.h"
 #include "tile_element/TrackElement.h"
 
+#include <atomic>
 #include <iterator>
 #include <memory>
 
@@ -113,6 +114,18 @@ static size_t _tileElementsInUse;
 static size_t _tileElementsInUseStash;
 static TileCoordsXY _mapSizeStash;
 
+// Position of the surface element within each tile, so MapGetSurfaceElementAt does not have to walk the tile.
+// Entries are dropped when their tile is rebuilt by TileElementInsert, or when TileElementRemove moves or removes the
+// surface element. Bumping the epoch lazily invalidates every entry.
+// Each entry packs the epoch in the upper 16 bits and the offset in the lowest 8. Lookups fill entries in, and they
+// happen from the paint threads at the same time, so entries are atomics. Concurrent fills all store the same value.
+using SurfaceElementCacheEntry = std::atomic<uint32_t>;
+static constexpr uint8_t kSurfaceElementOffsetUnknown = 0xFF;
+static std::unique_ptr<SurfaceElementCacheEntry[]> _surfaceElementCache;
+static std::unique_ptr<SurfaceElementCacheEntry[]> _surfaceElementCacheStash;
+static uint16_t _surfaceElementCacheEpoch = 1;
+static uint16_t _surfaceElementCacheEpochStash = 1;
+
 void StashMap()
 {
     auto& gameState = GetGameState();
@@ -120,6 +133,9 @@ void StashMap()
     _tileElementsStash = std::move(gameState.TileElements);
     _mapSizeStash = gameState.MapSize;
     _tileElementsInUseStash = _tileElementsInUse;
+    _surfaceElementCacheStash = std::move(_surfaceElementCache);
+    _surfaceElementCacheEpochStash = _surfaceElementCacheEpoch;
+    Park::InvalidateOwnedTileCount();
 }
 
 void UnstashMap()
@@ -129,6 +145,9 @@ void UnstashMap()
     gameState.TileElements = std::move(_tileElementsStash);
     gameState.MapSize = _mapSizeStash;
     _tileElementsInUse = _tileElementsInUseStash;
+    _surfaceElementCache = std::move(_surfaceElementCacheStash);
+    _surfaceElementCacheEpoch = _surfaceElementCacheEpochStash;
+    Park::InvalidateOwnedTileCount();
 }
 
 CoordsXY GetMapSizeUnits()
@@ -158,6 +177,9 @@ void SetTileElements(GameState_t& gameState, std::vector<TileElement>&& tileElem
     _tileIndex = TilePointerIndex<TileElement>(
         kMaximumMapSizeTechnical, gameState.TileElements.data(), gameState.TileElements.size());
     _tileElementsInUse = gameState.TileElements.size();
+    _surfaceElementCache = std::make_unique<SurfaceElementCacheEntry[]>(kMaximumMapSizeTechnical * kMaximumMapSizeTechnical);
+    _surfaceElementCacheEpoch = 1;
+    Park::InvalidateOwnedTileCount();
 }
 
 static TileElement GetDefaultSurfaceElement()
@@ -417,13 +439,91 @@ void MapSetTileElement(const TileCoordsXY& tilePos, TileElement* elements)
         return;
     }
     _tileIndex.SetTile(tilePos, elements);
+    MapInvalidateSurfaceElementCache(tilePos);
+}
+
+void MapInvalidateSurfaceElementCache(const TileCoordsXY& tilePos)
+{
+    if (IsTileLocationValid(tilePos) && _surfaceElementCache != nullptr)
+    {
+        _surfaceElementCache[tilePos.x + (tilePos.y * kMaximumMapSizeTechnical)].store(0, std::memory_order_relaxed);
+    }
+}
+
+static void invalidateAllSurfaceElementCache()
+{
+    _surfaceElementCacheEpoch++;
+    if (_surfaceElementCacheEpoch == 0)
+    {
+        // Wrapped around, stale entries could match again so clear them for real.
+        if (_surfaceElementCache != nullptr)
+        {
+            for (size_t i = 0; i < kMaximumMapSizeTechnical * kMaximumMapSizeTechnical; i++)
+            {
+                _surfaceElementCache[i].store(0, std::memory_order_relaxed);
+            }
+        }
+        _surfaceElementCacheEpoch = 1;
+    }
+}
+
+// Elements do not know their tile, so it is looked up by the first element of the tile.
+static void invalidateSurfaceElementCacheOf(const TileElement* element)
+{
+    const auto* firstElement = GetGameState().TileElements.data();
+    while (element != firstElement && !(element - 1)->IsLastForTile())
+    {
+        element--;
+    }
+
+    const auto tilePos = _tileIndex.FindTile(element);
+    if (tilePos.has_value())
+    {
+        MapInvalidateSurfaceElementCache(*tilePos);
+    }
+    else
+    {
+        invalidateAllSurfaceElementCache();
+    }
 }
 
 SurfaceElement* MapGetSurfaceElementAt(const TileCoordsXY& coords)
 {
-    auto view = TileElementsView<SurfaceElement>(coords);
+    auto* firstElement = MapGetFirstElementAt(coords);
+    if (firstElement == nullptr)
+        return nullptr;
+
+    auto& entry = _surfaceElementCache[coords.x + (coords.y * kMaximumMapSizeTechnical)];
+    const uint32_t cached = entry.load(std::memory_order_relaxed);
+    const uint8_t cachedOffset = cached & 0xFF;
+    if ((cached >> 16) == _surfaceElementCacheEpoch && cachedOffset != kSurfaceElementOffsetUnknown)
+    {
+        // Element types can still be changed in place (e.g. by swapping elements), so check before trusting it.
+        auto* surfaceElement = firstElement[cachedOffset].AsSurface();
+        if (surfaceElement != nullptr)
+        {
+#if defined(DEBUG_LEVEL_1) && DEBUG_LEVEL_1
+            Guard::Assert(
+                surfaceElement == *TileElementsView<SurfaceElement>(coords).begin(), "Surface element cache out of sync");
+#endif
+            return surfaceElement;
+        }
+    }
 
-    return *view.begin();
+    auto* tileElement = firstElement;
+    do
+    {
+        auto* surfaceElement = tileElement->AsSurface();
+        if (surfaceElement != nullptr)
+        {
+            auto offset = tileElement - firstElement;
+            const uint8_t cacheOffset = offset < kSurfaceElementOffsetUnknown ? static_cast<uint8_t>(offset)
+                                                                              : kSurfaceElementOffsetUnknown;
+            entry.store((static_cast<uint32_t>(_surfaceElementCacheEpoch) << 16) | cacheOffset, std::memory_order_relaxed);
+            return surfaceElement;
+        }
+    } while (!(tileElement++)->IsLastForTile());
+    return nullptr;
 }
 
 SurfaceElement* MapGetSurfaceElementAt(const CoordsXY& coords)
@@ -1027,6 +1127,11 @@ bool MapIsLocationAtEdge(const CoordsXY& loc)
  */
 void TileElementRemove(TileElement* tileElement)
 {
+    // Only elements after the removed one move, so the cached surface position only changes if that includes the
+    // surface. Usually the surface comes first and the element is above it.
+    const auto* removedElement = tileElement;
+    bool surfaceMoved = tileElement->GetType() == TileElementType::Surface;
+
     // Replace Nth element by (N+1)th element.
     // This loop will make tileElement point to the old last element position,
     // after copy it to it's new position
@@ -1034,6 +1139,7 @@ void TileElementRemove(TileElement* tileElement)
     {
         do
         {
+            surfaceMoved |= (tileElement + 1)->GetType() == TileElementType::Surface;
             *tileElement = *(tileElement + 1);
         } while (!(++tileElement)->IsLastForTile());
     }
@@ -1042,6 +1148,10 @@ void TileElementRemove(TileElement* tileElement)
     (tileElement - 1)->SetLastForTile(true);
     tileElement->BaseHeight = kMaxTileElementHeight;
     _tileElementsInUse--;
+    if (surfaceMoved)
+    {
+        invalidateSurfaceElementCacheOf(removedElement);
+    }
     auto& gameState = GetGameState();
     if (tileElement == &gameState.TileElements.back())
     {
@@ -1195,6 +1305,7 @@ TileElement* TileElementInsert(const CoordsXYZ& loc, int32_t occupiedQuadrants,
 
     // Set tile index pointer to point to new element block
     _tileIndex.SetTile(tileLoc, newTileElement);
+    MapInvalidateSurfaceElementCache(tileLoc);
 
     bool isLastForTile = false;
     if (originalTileElement == nullptr)
@@ -1331,7 +1442,7 @@ void MapRemoveOutOfRangeElements()
                 auto surfaceElement = MapGetSurfaceElementAt(CoordsXY{ x, y });
                 if (surfaceElement != nullptr)
                 {
-                    surfaceElement->SetOwnership(OWNERSHIP_UNOWNED);
+                    Park::SetTileOwnership(*surfaceElement, OWNERSHIP_UNOWNED);
                     Park::UpdateFencesAroundTile({ x, y });
                 }
                 ClearElementsAt({ x, y });
@@ -1348,7 +1459,7 @@ static void MapExtendBoundarySurfaceExtendTile(const SurfaceElement& sourceTile,
     destTile.SetSurfaceObjectIndex(sourceTile.GetSurfaceObjectIndex());
     destTile.SetEdgeObjectIndex(sourceTile.GetEdgeObjectIndex());
     destTile.SetGrassLength(sourceTile.GetGrassLength());
-    destTile.SetOwnership(OWNERSHIP_UNOWNED);
+    Park::SetTileOwnership(destTile, OWNERSHIP_UNOWNED);
     destTile.SetWaterHeight(sourceTile.GetWaterHeight());
 
     auto z = sourceTile.BaseHeight;
@@ -1435,7 +1546,7 @@ void ClearElementAt(const CoordsXY& loc, TileElement** elementPtr)
             element->AsSurface()->SetSurfaceObjectIndex(0);
             element->AsSurface()->SetEdgeObjectIndex(0);
             element->AsSurface()->SetGrassLength(GRASS_LENGTH_CLEAR_0);
-            element->AsSurface()->SetOwnership(OWNERSHIP_UNOWNED);
+            Park::SetTileOwnership(*element->AsSurface(), OWNERSHIP_UNOWNED);
             element->AsSurface()->SetParkFences(0);
             element->AsSurface()->SetWaterHeight(0);
             // Because this element is not completely removed, the pointer must be updated manually
@@ -2169,7 +2280,7 @@ void FixLandOwnershipTilesWithOwnership(std::vector<TileCoordsXY> tiles, uint8_t
         auto surfaceElement = MapGetSurfaceElementAt(tile);
         if (surfaceElement != nullptr)
         {
-            surfaceElement->SetOwnership(ownership);
+            Park::SetTileOwnership(*surfaceElement, ownership);
             Park::UpdateFencesAroundTile(tile.ToCoordsXY());
         }
     }
@@ -149,6 +149,7 @@ TileElement* MapGetFirstElementAt(const TileCoordsXY& tilePos);
 TileElement* MapGetNthElementAt(const CoordsXY& coords, int32_t n);
 TileElement* MapGetFirstTileElementWithBaseHeightBetween(const TileCoordsXYRangedZ& loc, TileElementType type);
 void MapSetTileElement(const TileCoordsXY& tilePos, TileElement* elements);
+void MapInvalidateSurfaceElementCache(const TileCoordsXY& tilePos);
 int32_t MapHeightFromSlope(const CoordsXY& coords, int32_t slopeDirection, bool isSloped);
 BannerElement* MapGetBannerElementAt(const CoordsXYZ& bannerPos, uint8_t direction);
 SurfaceElement* MapGetSurfaceElementAt(const TileCoordsXY& coords);
@@ -12,10 +12,12 @@
 #include "../Cheats.h"
 #include "../Context.h"
 #include "../Date.h"
+#include "../Diagnostic.h"
 #include "../Game.h"
 #include "../GameState.h"
 #include "../OpenRCT2.h"
 #include "../actions/ParkSetParameterAction.h"
+#include "../core/Guard.hpp"
 #include "../core/Memory.hpp"
 #include "../core/String.hpp"
 #include "../entity/Litter.h"
@@ -43,6 +45,7 @@
 #include "tile_element/SurfaceElement.h"
 
 #include <limits>
+#include <optional>
 #include <type_traits>
 
 using namespace OpenRCT2;
@@ -50,10 +53,16 @@ using namespace OpenRCT2::Scripting;
 
 namespace OpenRCT2::Park
 {
+    // Number of owned surface tiles, kept up to date by SetTileOwnership so the periodic park size update does not have to
+    // scan the whole map. Cleared whenever the map is replaced or edited in bulk, in which case the next update recounts.
+    static std::optional<uint32_t> _ownedTileCount;
+
     static money64 calculateRideValue(const Ride& ride);
     static money64 calculateTotalRideValueForMoney();
     static uint32_t calculateSuggestedMaxGuests();
     static uint32_t calculateGuestGenerationProbability();
+    static uint32_t countOwnedTiles();
+    static uint32_t getOwnedTileCount();
 
     static void generateGuests(GameState_t& gameState);
     static Guest* generateGuestFromCampaign(int32_t campaign);
@@ -359,14 +368,19 @@ namespace OpenRCT2::Park
         // Every ~102 seconds
         if (currentTicks % 4096 == 0)
         {
-            gameState.Park.Size = CalculateParkSize();
+            gameState.Park.Size = getOwnedTileCount();
             windowMgr->InvalidateByClass(WindowClass::ParkInformation);
         }
 
         generateGuests(gameState);
     }
 
-    uint32_t CalculateParkSize()
+    static bool isOwnershipCounted(uint8_t ownership)
+    {
+        return (ownership & (OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED | OWNERSHIP_OWNED)) != 0;
+    }
+
+    static uint32_t countOwnedTiles()
     {
         uint32_t tiles = 0;
         TileElementIterator it;
@@ -375,12 +389,54 @@ namespace OpenRCT2::Park
         {
             if (it.element->GetType() == TileElementType::Surface)
             {
-                if (it.element->AsSurface()->GetOwnership() & (OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED | OWNERSHIP_OWNED))
+                if (isOwnershipCounted(it.element->AsSurface()->GetOwnership()))
                 {
                     tiles++;
                 }
             }
         } while (TileElementIteratorNext(&it));
+        return tiles;
+    }
+
+    static uint32_t getOwnedTileCount()
+    {
+        if (!_ownedTileCount.has_value())
+        {
+            return CalculateParkSize();
+        }
+
+#if defined(DEBUG_LEVEL_1) && DEBUG_LEVEL_1
+        const auto recounted = countOwnedTiles();
+        Guard::Assert(
+            recounted == *_ownedTileCount, "Owned tile count out of sync: tracked %u, actual %u", *_ownedTileCount, recounted);
+#endif
+        return *_ownedTileCount;
+    }
+
+    void SetTileOwnership(SurfaceElement& surfaceElement, uint8_t ownership)
+    {
+        const bool wasCounted = isOwnershipCounted(surfaceElement.GetOwnership());
+        surfaceElement.SetOwnership(ownership);
+
+        if (_ownedTileCount.has_value())
+        {
+            const bool isCounted = isOwnershipCounted(surfaceElement.GetOwnership());
+            if (isCounted && !wasCounted)
+                (*_ownedTileCount)++;
+            else if (!isCounted && wasCounted)
+                (*_ownedTileCount)--;
+        }
+    }
+
+    void InvalidateOwnedTileCount()
+    {
+        _ownedTileCount.reset();
+    }
+
+    uint32_t CalculateParkSize()
+    {
+        const auto tiles = countOwnedTiles();
+        _ownedTileCount = tiles;
 
         auto& gameState = GetGameState();
         if (tiles != gameState.Park.Size)
@@ -51,6 +51,7 @@ enum : uint32_t
 };
 
 struct Guest;
+struct SurfaceElement;
 
 namespace OpenRCT2
 {
@@ -90,6 +91,8 @@ namespace OpenRCT2
         int32_t GetForcedRating();
 
         uint32_t UpdateSize(OpenRCT2::GameState_t& gameState);
+        void SetTileOwnership(SurfaceElement& surfaceElement, uint8_t ownership);
+        void InvalidateOwnedTileCount();
 
         void UpdateFences(const CoordsXY& coords);
         void UpdateFencesAroundTile(const CoordsXY& coords);
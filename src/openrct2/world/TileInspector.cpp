@@ -77,6 +77,7 @@ namespace OpenRCT2::TileInspector
             firstElement->SetLastForTile(!firstElement->IsLastForTile());
             secondElement->SetLastForTile(!secondElement->IsLastForTile());
         }
+        MapInvalidateSurfaceElementCache(TileCoordsXY(loc));
 
         return GameActions::Result();
     }
@@ -165,6 +166,11 @@ namespace OpenRCT2::TileInspector
                 tileElement->RemoveBannerEntry();
             }
 
+            if (tileElement->GetType() == TileElementType::Surface)
+            {
+                Park::InvalidateOwnedTileCount();
+            }
+
             TileElementRemove(tileElement);
 
             if (IsTileSelected(loc))
@@ -352,6 +358,11 @@ namespace OpenRCT2::TileInspector
 
             MapAnimationAutoCreateAtTileElement(tileLoc, pastedElement);
 
+            if (pastedElement->GetType() == TileElementType::Surface)
+            {
+                Park::InvalidateOwnedTileCount();
+            }
+
             if (IsTileSelected(loc))
             {
                 windowTileInspectorElementCount++;
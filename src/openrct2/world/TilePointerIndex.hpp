@@ -11,8 +11,10 @@
 
 #include "Location.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <cstdint>
+#include <optional>
 #include <vector>
 
 template<typename T>
@@ -53,4 +55,15 @@ public:
     {
         TilePointers[coords.x + (coords.y * MapSize)] = tileElement;
     }
+
+    // Goes through every tile, so only for the rare cases where an element's tile is not known.
+    std::optional<TileCoordsXY> FindTile(const T* firstElement) const
+    {
+        const auto it = std::find(TilePointers.begin(), TilePointers.end(), firstElement);
+        if (it == TilePointers.end())
+            return std::nullopt;
+
+        const auto index = static_cast<int32_t>(it - TilePointers.begin());
+        return TileCoordsXY(index % MapSize, index / MapSize);
+    }
 };
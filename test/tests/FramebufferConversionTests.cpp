@@ -0,0 +1,265 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2025 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <gtest/gtest.h>
+#include <openrct2/drawing/Drawing.h>
+#include <openrct2/drawing/X8DrawingEngine.h>
+#include <random>
+#include <vector>
+
+using namespace OpenRCT2::Drawing;
+
+// The software engine's frame handling without a window, redrawing dirty blocks with a background colour.
+class PresentTestDrawingEngine final : public X8DrawingEngine
+{
+public:
+    PresentTestDrawingEngine()
+        : X8DrawingEngine(nullptr)
+    {
+    }
+
+    void TakePresentRects(std::vector<PresentRect>& rects)
+    {
+        _presentGrid.TakeRects(rects);
+    }
+
+protected:
+    void OnDrawDirtyBlock(uint32_t x, uint32_t y, uint32_t columns, uint32_t rows) override
+    {
+        const uint32_t left = x << _dirtyGrid.BlockShiftX;
+        const uint32_t top = y << _dirtyGrid.BlockShiftY;
+        const uint32_t right = std::min(_width, (x + columns) << _dirtyGrid.BlockShiftX);
+        const uint32_t bottom = std::min(_height, (y + rows) << _dirtyGrid.BlockShiftY);
+        for (uint32_t yy = top; yy < bottom; yy++)
+        {
+            std::fill(&_bits[yy * _pitch + left], &_bits[yy * _pitch + right], PALETTE_INDEX_10);
+        }
+    }
+};
+
+// 4K frame with the default dirty block size, padded like the software engine's surfaces.
+static constexpr int32_t kWidth = 3840;
+static constexpr int32_t kHeight = 2160;
+static constexpr int32_t kPitch = kWidth + 64;
+static constexpr uint32_t kBlockShiftX = 7;
+static constexpr uint32_t kBlockShiftY = 5;
+
+class FramebufferConversionTests : public testing::Test
+{
+protected:
+    std::vector<uint8_t> _bits;
+    uint32_t _palette[256];
+    std::mt19937 _random{ 1234 };
+
+    void SetUp() override
+    {
+        _bits.resize(kPitch * kHeight);
+        for (auto& pixel : _bits)
+        {
+            pixel = static_cast<uint8_t>(_random());
+        }
+        for (uint32_t i = 0; i < 256; i++)
+        {
+            _palette[i] = 0xFF000000 | (i * 0x010203);
+        }
+    }
+
+    std::vector<uint32_t> ConvertAll()
+    {
+        std::vector<uint32_t> result(kWidth * kHeight);
+        PaletteLookupScalar(kWidth, kHeight, _bits.data(), result.data(), kPitch - kWidth, 0, _palette);
+        return result;
+    }
+
+    void ConvertRects(const std::vector<PresentRect>& rects, std::vector<uint32_t>& frame)
+    {
+        for (const auto& rect : rects)
+        {
+            const auto width = static_cast<int32_t>(rect.Width);
+            PaletteLookupFn(
+                width, static_cast<int32_t>(rect.Height), &_bits[rect.Y * kPitch + rect.X], &frame[rect.Y * kWidth + rect.X],
+                kPitch - width, kWidth - width, _palette);
+        }
+    }
+
+    // Draws into a few random areas like the game would between two frames, marking them in the grid.
+    void DrawRandomAreas(PresentDirtyGrid& grid, int32_t count)
+    {
+        std::uniform_int_distribution<int32_t> x(-50, kWidth);
+        std::uniform_int_distribution<int32_t> y(-50, kHeight);
+        std::uniform_int_distribution<int32_t> size(1, 300);
+        for (int32_t i = 0; i < count; i++)
+        {
+            const auto left = x(_random);
+            const auto top = y(_random);
+            const auto right = std::min(left + size(_random), kWidth);
+            const auto bottom = std::min(top + size(_random), kHeight);
+            for (auto yy = std::max(top, 0); yy < bottom; yy++)
+            {
+                for (auto xx = std::max(left, 0); xx < right; xx++)
+                {
+                    _bits[yy * kPitch + xx]++;
+                }
+            }
+            grid.Invalidate(left, top, right, bottom);
+        }
+    }
+
+    static uint64_t GetArea(const std::vector<PresentRect>& rects)
+    {
+        uint64_t area = 0;
+        for (const auto& rect : rects)
+        {
+            area += static_cast<uint64_t>(rect.Width) * rect.Height;
+        }
+        return area;
+    }
+};
+
+TEST_F(FramebufferConversionTests, LookupMatchesScalar)
+{
+    // Odd sizes and offsets so the vector loops run into their tails.
+    const int32_t width = 1001;
+    const int32_t height = 7;
+    std::vector<uint32_t> expected(kWidth * height);
+    std::vector<uint32_t> actual(kWidth * height);
+    PaletteLookupScalar(width, height, &_bits[3], expected.data(), kPitch - width, kWidth - width, _palette);
+    PaletteLookupFn(width, height, &_bits[3], actual.data(), kPitch - width, kWidth - width, _palette);
+    ASSERT_EQ(actual, expected);
+}
+
+TEST_F(FramebufferConversionTests, TakeRectsCoversChanges)
+{
+    PresentDirtyGrid grid;
+    grid.Configure(kWidth, kHeight, kBlockShiftX, kBlockShiftY);
+
+    std::vector<PresentRect> rects;
+    grid.TakeRects(rects);
+    ASSERT_EQ(rects.size(), 1u);
+    ASSERT_EQ(GetArea(rects), static_cast<uint64_t>(kWidth) * kHeight);
+    auto frame = ConvertAll();
+
+    for (int32_t i = 0; i < 10; i++)
+    {
+        DrawRandomAreas(grid, 20);
+        grid.TakeRects(rects);
+        for (const auto& rect : rects)
+        {
+            ASSERT_LE(rect.X + rect.Width, static_cast<uint32_t>(kWidth));
+            ASSERT_LE(rect.Y + rect.Height, static_cast<uint32_t>(kHeight));
+        }
+        ConvertRects(rects, frame);
+        ASSERT_EQ(frame, ConvertAll()) << "frame " << i;
+    }
+
+    // Nothing changed, nothing to convert.
+    grid.TakeRects(rects);
+    ASSERT_TRUE(rects.empty());
+}
+
+TEST_F(FramebufferConversionTests, PaletteChangeOnlyInvalidatesItsPixels)
+{
+    PresentDirtyGrid grid;
+    grid.Configure(kWidth, kHeight, kBlockShiftX, kBlockShiftY);
+    std::vector<PresentRect> rects;
+
+    // A lake of animated water entries in the middle of a frame that uses none of them elsewhere.
+    constexpr uint8_t kFirstAnimated = 230;
+    constexpr uint8_t kAnimatedCount = 16;
+    for (int32_t y = 0; y < kHeight; y++)
+    {
+        for (int32_t x = 0; x < kWidth; x++)
+        {
+            auto& pixel = _bits[y * kPitch + x];
+            if (x >= 1000 && x < 1500 && y >= 700 && y < 900)
+                pixel = kFirstAnimated + ((x + y) % kAnimatedCount);
+            else if (pixel >= kFirstAnimated && pixel < kFirstAnimated + kAnimatedCount)
+                pixel = 10;
+        }
+    }
+    grid.TakeRects(rects);
+    auto frame = ConvertAll();
+
+    std::array<bool, 256> changed{};
+    for (uint8_t i = 0; i < kAnimatedCount; i++)
+    {
+        changed[kFirstAnimated + i] = true;
+        _palette[kFirstAnimated + i] ^= 0x00FFFFFF;
+    }
+    grid.InvalidatePaletteEntries(_bits.data(), kPitch, changed);
+    grid.TakeRects(rects);
+
+    // Only the blocks overlapping the lake, 128 x 32 pixel blocks from (896, 672) to (1536, 928).
+    ASSERT_EQ(rects.size(), 1u);
+    EXPECT_EQ(rects[0].X, 896u);
+    EXPECT_EQ(rects[0].Y, 672u);
+    EXPECT_EQ(rects[0].Width, 640u);
+    EXPECT_EQ(rects[0].Height, 256u);
+
+    ConvertRects(rects, frame);
+    ASSERT_EQ(frame, ConvertAll());
+
+    // An unchanged palette marks nothing.
+    grid.InvalidatePaletteEntries(_bits.data(), kPitch, std::array<bool, 256>{});
+    grid.TakeRects(rects);
+    ASSERT_TRUE(rects.empty());
+}
+
+TEST_F(FramebufferConversionTests, RedrawnOverlayIsPresented)
+{
+    constexpr int32_t kEngineWidth = 640;
+    constexpr int32_t kEngineHeight = 480;
+    constexpr ScreenRect kOverlay = { { 300, 200 }, { 340, 240 } };
+
+    PresentTestDrawingEngine engine;
+    engine.Resize(kEngineWidth, kEngineHeight);
+    std::vector<PresentRect> rects;
+    engine.TakePresentRects(rects);
+
+    const auto covers = [&](const ScreenRect& area) {
+        for (int32_t y = area.GetTop(); y < area.GetBottom(); y++)
+        {
+            for (int32_t x = area.GetLeft(); x < area.GetRight(); x++)
+            {
+                const bool covered = std::any_of(rects.begin(), rects.end(), [x, y](const PresentRect& rect) {
+                    return static_cast<uint32_t>(x) >= rect.X && static_cast<uint32_t>(x) < rect.X + rect.Width
+                        && static_cast<uint32_t>(y) >= rect.Y && static_cast<uint32_t>(y) < rect.Y + rect.Height;
+                });
+                if (!covered)
+                    return false;
+            }
+        }
+        return true;
+    };
+
+    // Like the picked up peep, the overlay is drawn straight into the frame and its area invalidated afterwards.
+    auto& dpi = *engine.GetDrawingPixelInfo();
+    for (int32_t y = kOverlay.GetTop(); y < kOverlay.GetBottom(); y++)
+    {
+        std::fill_n(&dpi.bits[y * dpi.LineStride() + kOverlay.GetLeft()], kOverlay.GetWidth(), PALETTE_INDEX_21);
+    }
+    engine.Invalidate(kOverlay.GetLeft(), kOverlay.GetTop(), kOverlay.GetRight(), kOverlay.GetBottom());
+    engine.TakePresentRects(rects);
+    ASSERT_TRUE(covers(kOverlay));
+
+    // The next frame redraws the area underneath, which has to be presented to remove the overlay.
+    engine.BeginDraw();
+    engine.PaintWindows();
+    engine.TakePresentRects(rects);
+    ASSERT_TRUE(covers(kOverlay));
+    ASSERT_EQ(dpi.bits[kOverlay.GetTop() * dpi.LineStride() + kOverlay.GetLeft()], PALETTE_INDEX_10);
+
+    // Nothing was invalidated since.
+    engine.BeginDraw();
+    engine.PaintWindows();
+    engine.TakePresentRects(rects);
+    ASSERT_TRUE(rects.empty());
+}
@@ -0,0 +1,213 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2025 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <gtest/gtest.h>
+#include <openrct2/drawing/Drawing.h>
+#include <openrct2/platform/Platform.h>
+#include <random>
+#include <vector>
+
+using namespace OpenRCT2;
+
+using LightAccumulateFunc = decltype(&LightAccumulateScalar);
+using LightBlendFunc = decltype(&LightBlendScalar);
+
+struct LightKernel
+{
+    const char* Name;
+    LightAccumulateFunc Accumulate;
+    LightBlendFunc Blend;
+};
+
+// Only the kernels the CPU running the tests can execute.
+static std::vector<LightKernel> GetKernels()
+{
+    std::vector<LightKernel> kernels = { { "scalar", LightAccumulateScalar, LightBlendScalar } };
+    if (Platform::SSE41Available())
+        kernels.push_back({ "sse4.1", LightAccumulateSse4_1, LightBlendSse4_1 });
+    if (Platform::AVX2Available())
+        kernels.push_back({ "avx2", LightAccumulateAvx2, LightBlendAvx2 });
+    return kernels;
+}
+
+class LightFxTests : public testing::Test
+{
+protected:
+    std::mt19937 _random{ 4321 };
+
+    std::vector<uint8_t> RandomBytes(size_t size, int32_t zeroPercentage = 0)
+    {
+        std::vector<uint8_t> result(size);
+        for (auto& value : result)
+        {
+            value = static_cast<int32_t>(_random() % 100) < zeroPercentage ? 0 : static_cast<uint8_t>(_random());
+        }
+        return result;
+    }
+
+    // The per pixel loops LightFX used before the kernels existed.
+    static void AccumulateReference(
+        int32_t width, int32_t height, const uint8_t* src, uint8_t* dst, int32_t srcSkip, int32_t dstSkip, uint8_t intensity)
+    {
+        for (int32_t y = 0; y < height; y++)
+        {
+            for (int32_t x = 0; x < width; x++)
+            {
+                if (intensity == 0xFF)
+                    *dst = std::min(0xFF, *dst + *src);
+                else
+                    *dst = std::min(0xFF, *dst + (((*src) * (1 + intensity)) >> 8));
+                dst++;
+                src++;
+            }
+            dst += dstSkip;
+            src += srcSkip;
+        }
+    }
+
+    static uint8_t MixLight(uint32_t a, uint32_t b, uint32_t intensity)
+    {
+        intensity = intensity * 6;
+        uint32_t bMul = (b * intensity) >> 8;
+        uint32_t ab = a + bMul;
+        return static_cast<uint8_t>(std::min<uint32_t>(255, ab));
+    }
+
+    static uint32_t BlendReference(uint32_t darkColour, uint32_t lightColour, uint8_t lightIntensity)
+    {
+        if (lightIntensity == 0)
+            return darkColour;
+
+        uint32_t colour = 0;
+        colour |= MixLight((darkColour >> 0) & 0xFF, (lightColour >> 0) & 0xFF, lightIntensity);
+        colour |= MixLight((darkColour >> 8) & 0xFF, (lightColour >> 8) & 0xFF, lightIntensity) << 8;
+        colour |= MixLight((darkColour >> 16) & 0xFF, (lightColour >> 16) & 0xFF, lightIntensity) << 16;
+        colour |= MixLight((darkColour >> 24) & 0xFF, (lightColour >> 24) & 0xFF, lightIntensity) << 24;
+        return colour;
+    }
+};
+
+TEST_F(LightFxTests, AccumulateMatchesReference)
+{
+    // A light texture partly clipped by the screen edge, so rows have odd lengths and need both wraps.
+    constexpr int32_t kSrcWidth = 128;
+    constexpr int32_t kDstWidth = 301;
+    constexpr int32_t kHeight = 40;
+    const auto src = RandomBytes(kSrcWidth * kHeight, 30);
+    const auto initial = RandomBytes(kDstWidth * kHeight, 50);
+
+    for (const auto& kernel : GetKernels())
+    {
+        for (int32_t width : { 1, 15, 16, 33, 97, 128 })
+        {
+            for (uint8_t intensity : { 0, 1, 100, 127, 254, 255 })
+            {
+                auto expected = initial;
+                auto actual = initial;
+                AccumulateReference(width, kHeight, &src[3], &expected[5], kSrcWidth - width, kDstWidth - width, intensity);
+                kernel.Accumulate(width, kHeight, &src[3], &actual[5], kSrcWidth - width, kDstWidth - width, intensity);
+                ASSERT_EQ(actual, expected) << kernel.Name << ", width: " << width
+                                            << ", intensity: " << static_cast<int32_t>(intensity);
+            }
+        }
+    }
+}
+
+TEST_F(LightFxTests, BlendMatchesReference)
+{
+    constexpr int32_t kWidth = 203;
+    constexpr int32_t kHeight = 17;
+    constexpr int32_t kDstPitch = 256;
+    const auto bits = RandomBytes(kWidth * kHeight);
+    // Mostly dark like a night scene, with the brightest values to check the channels saturate.
+    auto light = RandomBytes(kWidth * kHeight, 60);
+    std::fill_n(light.begin(), 40, 0xFF);
+
+    uint32_t palette[256];
+    uint32_t lightPalette[256];
+    for (int32_t i = 0; i < 256; i++)
+    {
+        palette[i] = _random();
+        lightPalette[i] = _random();
+    }
+
+    std::vector<uint32_t> expected(kDstPitch * kHeight, 0xDEADBEEF);
+    for (int32_t y = 0; y < kHeight; y++)
+    {
+        for (int32_t x = 0; x < kWidth; x++)
+        {
+            auto index = bits[y * kWidth + x];
+            expected[y * kDstPitch + x] = BlendReference(palette[index], lightPalette[index], light[y * kWidth + x]);
+        }
+    }
+
+    for (const auto& kernel : GetKernels())
+    {
+        std::vector<uint32_t> actual(kDstPitch * kHeight, 0xDEADBEEF);
+        kernel.Blend(
+            kWidth, kHeight, bits.data(), light.data(), actual.data(), 0, 0, kDstPitch - kWidth, palette, lightPalette);
+        ASSERT_EQ(actual, expected) << kernel.Name;
+    }
+}
+
+// Not a pass/fail test, prints the cost of lighting a 4K frame with each kernel the CPU supports: scalar, SSE4.1 and
+// AVX2. Disabled by default, run it with
+// `OpenRCT2Tests --gtest_also_run_disabled_tests --gtest_filter=LightFxTests.DISABLED_KernelCost`.
+TEST_F(LightFxTests, DISABLED_KernelCost)
+{
+    constexpr int32_t kWidth = 3840;
+    constexpr int32_t kHeight = 2160;
+    constexpr int32_t kLightSize = 256;
+    constexpr int32_t kLights = 200;
+    constexpr int32_t kIterations = 10;
+
+    const auto bits = RandomBytes(kWidth * kHeight);
+    const auto lightTexture = RandomBytes(kLightSize * kLightSize);
+    std::vector<uint8_t> light(kWidth * kHeight);
+    std::vector<uint32_t> frame(kWidth * kHeight);
+    uint32_t palette[256];
+    uint32_t lightPalette[256];
+    for (int32_t i = 0; i < 256; i++)
+    {
+        palette[i] = _random();
+        lightPalette[i] = _random();
+    }
+
+    for (const auto& kernel : GetKernels())
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (int32_t i = 0; i < kIterations; i++)
+        {
+            std::fill(light.begin(), light.end(), 0);
+            for (int32_t l = 0; l < kLights; l++)
+            {
+                const auto x = (l * 397) % (kWidth - kLightSize);
+                const auto y = (l * 151) % (kHeight - kLightSize);
+                kernel.Accumulate(
+                    kLightSize, kLightSize, lightTexture.data(), &light[y * kWidth + x], 0, kWidth - kLightSize,
+                    static_cast<uint8_t>(l));
+            }
+        }
+        auto accumulate = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start);
+
+        start = std::chrono::steady_clock::now();
+        for (int32_t i = 0; i < kIterations; i++)
+        {
+            kernel.Blend(kWidth, kHeight, bits.data(), light.data(), frame.data(), 0, 0, 0, palette, lightPalette);
+        }
+        auto blend = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start);
+
+        std::printf(
+            "%s: accumulate %d lights %.2f ms, blend %.2f ms\n", kernel.Name, kLights, accumulate.count() / kIterations,
+            blend.count() / kIterations);
+    }
+}
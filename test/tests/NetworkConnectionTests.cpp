@@ -0,0 +1,256 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2025 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifndef DISABLE_NETWORK
+
+    #include <algorithm>
+    #include <chrono>
+    #include <cstdint>
+    #include <cstdio>
+    #include <gtest/gtest.h>
+    #include <memory>
+    #include <openrct2/Context.h>
+    #include <openrct2/OpenRCT2.h>
+    #include <openrct2/network/NetworkBase.h>
+    #include <openrct2/network/NetworkConnection.h>
+    #include <openrct2/network/Socket.h>
+    #include <vector>
+
+// Connected socket that records what is sent, accepting at most MaxBytesPerSend bytes per call.
+class RecordingSocket final : public ITcpSocket
+{
+public:
+    std::vector<uint8_t> Sent;
+    size_t MaxBytesPerSend = SIZE_MAX;
+
+    SocketStatus GetStatus() const override
+    {
+        return SocketStatus::Connected;
+    }
+    const char* GetError() const override
+    {
+        return nullptr;
+    }
+    const char* GetHostName() const override
+    {
+        return "localhost";
+    }
+    std::string GetIpAddress() const override
+    {
+        return "127.0.0.1";
+    }
+    void Listen(uint16_t) override
+    {
+    }
+    void Listen(const std::string&, uint16_t) override
+    {
+    }
+    std::unique_ptr<ITcpSocket> Accept() override
+    {
+        return nullptr;
+    }
+    void Connect(const std::string&, uint16_t) override
+    {
+    }
+    void ConnectAsync(const std::string&, uint16_t) override
+    {
+    }
+    size_t SendData(const void* buffer, size_t size) override
+    {
+        const SocketSendBuffer buffers[] = { { buffer, size } };
+        return SendData(buffers);
+    }
+    size_t SendData(std::span<const SocketSendBuffer> buffers) override
+    {
+        size_t totalSent = 0;
+        for (const auto& buffer : buffers)
+        {
+            auto size = std::min(buffer.Size, MaxBytesPerSend - totalSent);
+            auto* data = static_cast<const uint8_t*>(buffer.Data);
+            Sent.insert(Sent.end(), data, data + size);
+            totalSent += size;
+            if (totalSent == MaxBytesPerSend)
+                break;
+        }
+        return totalSent;
+    }
+    NetworkReadPacket ReceiveData(void*, size_t, size_t* sizeReceived) override
+    {
+        *sizeReceived = 0;
+        return NetworkReadPacket::NoData;
+    }
+    void SetNoDelay(bool) override
+    {
+    }
+    void Finish() override
+    {
+    }
+    void Disconnect() override
+    {
+    }
+    void Close() override
+    {
+    }
+};
+
+static NetworkPacket CreatePacket(NetworkCommand command, uint8_t value, size_t size)
+{
+    NetworkPacket packet(command);
+    for (size_t i = 0; i < size; i++)
+    {
+        packet << value;
+    }
+    return packet;
+}
+
+static std::unique_ptr<NetworkConnection> CreateConnection()
+{
+    auto connection = std::make_unique<NetworkConnection>();
+    connection->Socket = std::make_unique<RecordingSocket>();
+    connection->AuthStatus = NetworkAuth::Ok;
+    return connection;
+}
+
+static RecordingSocket& GetSocket(NetworkConnection& connection)
+{
+    return static_cast<RecordingSocket&>(*connection.Socket);
+}
+
+TEST(NetworkConnectionTests, SharedBufferSendsSameBytes)
+{
+    auto packet = CreatePacket(NetworkCommand::Chat, 7, 100);
+    auto buffer = NetworkConnection::SerialisePacket(packet);
+
+    auto a = CreateConnection();
+    auto b = CreateConnection();
+    a->QueuePacket(packet, buffer);
+    b->QueuePacket(packet);
+    a->SendQueuedData();
+    b->SendQueuedData();
+
+    ASSERT_EQ(GetSocket(*a).Sent, *buffer);
+    ASSERT_EQ(GetSocket(*b).Sent, *buffer);
+}
+
+TEST(NetworkConnectionTests, PartialSendsResume)
+{
+    auto connection = CreateConnection();
+    auto& socket = GetSocket(*connection);
+    socket.MaxBytesPerSend = 5;
+
+    std::vector<uint8_t> expected;
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        auto packet = CreatePacket(NetworkCommand::Chat, i, 3 + i);
+        auto buffer = NetworkConnection::SerialisePacket(packet);
+        expected.insert(expected.end(), buffer->begin(), buffer->end());
+        connection->QueuePacket(packet, buffer);
+    }
+
+    // Queueing at the front must not interrupt the packet currently being sent.
+    connection->SendQueuedData();
+    auto frontPacket = CreatePacket(NetworkCommand::Ping, 9, 2);
+    auto frontBuffer = NetworkConnection::SerialisePacket(frontPacket);
+    connection->QueuePacket(frontPacket, frontBuffer, true);
+    auto firstPacketSize = NetworkConnection::SerialisePacket(CreatePacket(NetworkCommand::Chat, 0, 3))->size();
+    expected.insert(expected.begin() + firstPacketSize, frontBuffer->begin(), frontBuffer->end());
+
+    for (size_t i = 0; i < expected.size(); i++)
+    {
+        connection->SendQueuedData();
+    }
+    ASSERT_EQ(socket.Sent, expected);
+}
+
+static std::unique_ptr<OpenRCT2::IContext> CreateNetworkContext()
+{
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+    auto context = OpenRCT2::CreateContext();
+    if (!context->Initialise())
+        return nullptr;
+    return context;
+}
+
+// Connects clients to the server until it has the given number, returning the socket of each client.
+static void AddClients(NetworkBase& network, std::vector<RecordingSocket*>& sockets, size_t count)
+{
+    while (sockets.size() < count)
+    {
+        auto socket = std::make_unique<RecordingSocket>();
+        sockets.push_back(socket.get());
+        network.AddClient(std::move(socket));
+    }
+}
+
+TEST(NetworkConnectionTests, BroadcastReachesEveryConnection)
+{
+    auto context = CreateNetworkContext();
+    ASSERT_NE(context, nullptr);
+    auto& network = context->GetNetwork();
+    std::vector<RecordingSocket*> sockets;
+    AddClients(network, sockets, 8);
+
+    // A broadcast serialises each packet once and every connection sends the same bytes.
+    constexpr size_t kPacketsPerRound = 64;
+    std::vector<uint8_t> expected;
+    for (size_t i = 0; i < kPacketsPerRound; i++)
+    {
+        auto packet = CreatePacket(NetworkCommand::Chat, static_cast<uint8_t>(i), 200);
+        auto buffer = NetworkConnection::SerialisePacket(packet);
+        expected.insert(expected.end(), buffer->begin(), buffer->end());
+        network.SendPacketToClients(packet);
+    }
+
+    // Game commands are only sent to clients that have joined as a player, which none of these have.
+    network.SendPacketToClients(CreatePacket(NetworkCommand::GameAction, 1, 200), false, true);
+
+    network.Flush();
+    for (const auto* socket : sockets)
+    {
+        ASSERT_EQ(socket->Sent, expected);
+    }
+}
+
+// Not a pass/fail test, prints the cost of broadcasting a tick's worth of packets to n clients. Disabled by default,
+// run it with `OpenRCT2Tests --gtest_also_run_disabled_tests --gtest_filter=NetworkConnectionTests.DISABLED_*`.
+TEST(NetworkConnectionTests, DISABLED_BroadcastFanOutCost)
+{
+    auto context = CreateNetworkContext();
+    ASSERT_NE(context, nullptr);
+    auto& network = context->GetNetwork();
+    std::vector<RecordingSocket*> sockets;
+
+    constexpr size_t kPacketsPerRound = 64;
+    auto packet = CreatePacket(NetworkCommand::Chat, 1, 200);
+    for (size_t numClients : { 1, 8, 32, 128 })
+    {
+        AddClients(network, sockets, numClients);
+        for (auto* socket : sockets)
+        {
+            socket->Sent.clear();
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < kPacketsPerRound; i++)
+        {
+            network.SendPacketToClients(packet);
+        }
+        network.Flush();
+        auto duration = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start);
+
+        std::printf("%zu clients: %.1f us\n", numClients, duration.count());
+        for (const auto* socket : sockets)
+        {
+            ASSERT_EQ(socket->Sent.size(), kPacketsPerRound * (packet.Data.size() + sizeof(PacketHeader)));
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,178 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2025 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TestData.h"
+
+#include <algorithm>
+#include <array>
+#include <gtest/gtest.h>
+#include <memory>
+#include <openrct2/Context.h>
+#include <openrct2/Game.h>
+#include <openrct2/GameState.h>
+#include <openrct2/OpenRCT2.h>
+#include <openrct2/core/Numerics.hpp>
+#include <openrct2/interface/Viewport.h>
+#include <openrct2/paint/Paint.h>
+#include <openrct2/paint/PaintTileCache.h>
+#include <openrct2/world/Map.h>
+#include <vector>
+
+using namespace OpenRCT2;
+
+static constexpr int32_t kViewWidth = 640;
+static constexpr int32_t kViewHeight = 480;
+
+// A paint struct or attachment as it would be drawn.
+struct PaintedImage
+{
+    ImageId Image;
+    ImageId ColourImage;
+    ScreenCoordsXY Position;
+    std::array<int32_t, 6> Bounds;
+    const TileElement* Element;
+    ViewportInteractionItem InteractionItem;
+
+    bool operator==(const PaintedImage& other) const = default;
+};
+
+class PaintTileCacheTests : public testing::Test
+{
+protected:
+    static void SetUpTestCase()
+    {
+        std::string parkPath = TestData::GetParkPath("bpb.sv6");
+        gOpenRCT2Headless = true;
+        // Paint structs are only created for images that exist, so the sprites have to be loaded.
+        gOpenRCT2NoGraphics = false;
+        _context = CreateContext();
+        bool initialised = _context->Initialise();
+        ASSERT_TRUE(initialised);
+
+        GetContext()->LoadParkFromFile(parkPath);
+        GameLoadInit();
+        SUCCEED();
+    }
+
+    static void TearDownTestCase()
+    {
+        PaintTileCacheSetEnabled(true);
+        if (_context)
+            _context.reset();
+    }
+
+    static Viewport GetViewport(ZoomLevel zoom, uint8_t rotation, uint32_t flags)
+    {
+        const auto& mapSize = GetGameState().MapSize;
+        const CoordsXY centre = { (mapSize.x / 2) * kCoordsXYStep + 16, (mapSize.y / 2) * kCoordsXYStep + 16 };
+        const auto centre2d = Translate3DTo2DWithZ(rotation, { centre, TileElementHeight(centre) });
+
+        Viewport viewport{};
+        viewport.width = kViewWidth;
+        viewport.height = kViewHeight;
+        viewport.zoom = zoom;
+        viewport.rotation = rotation;
+        viewport.flags = flags;
+        viewport.viewPos = { centre2d.x - (viewport.ViewWidth() / 2), centre2d.y - (viewport.ViewHeight() / 2) };
+        return viewport;
+    }
+
+    static void AddPaintStruct(std::vector<PaintedImage>& images, const PaintStruct* ps)
+    {
+        const auto& bounds = ps->Bounds;
+        images.push_back({ ps->image_id, ImageId(), ps->ScreenPos,
+                           { bounds.x, bounds.y, bounds.z, bounds.x_end, bounds.y_end, bounds.z_end }, ps->Element,
+                           ps->InteractionItem });
+        for (const auto* attached = ps->Attached; attached != nullptr; attached = attached->NextEntry)
+        {
+            images.push_back(
+                { attached->image_id, attached->ColourImageId, attached->RelativePos, {}, nullptr,
+                  ViewportInteractionItem::None });
+        }
+        if (ps->Children != nullptr)
+        {
+            AddPaintStruct(images, ps->Children);
+        }
+    }
+
+    /**
+     * Paints the view in columns like ViewportPaint, each split into the given number of sessions, and returns
+     * everything that would be drawn in drawing order.
+     */
+    static std::vector<PaintedImage> PaintView(const Viewport& viewport, int32_t splits)
+    {
+        PaintTileCacheBeginView(viewport.ViewWidth(), viewport.ViewHeight());
+
+        const int32_t left = viewport.zoom.ApplyInversedTo(viewport.viewPos.x);
+        const int32_t right = left + viewport.width;
+        const int32_t columnWidth = viewport.zoom.ApplyInversedTo(kCoordsXYStep) / splits;
+        std::vector<PaintedImage> images;
+        for (int32_t x = Numerics::floor2(left, columnWidth); x < right; x += columnWidth)
+        {
+            DrawPixelInfo dpi{};
+            dpi.x = std::max(x, left);
+            dpi.y = viewport.zoom.ApplyInversedTo(viewport.viewPos.y);
+            dpi.width = std::min(x + columnWidth, right) - dpi.x;
+            dpi.height = viewport.height;
+            dpi.zoom_level = viewport.zoom;
+
+            auto* session = PaintSessionAlloc(dpi, viewport.flags, viewport.rotation);
+            PaintSessionGenerate(*session);
+            PaintSessionArrange(*session);
+            for (const auto* ps = session->PaintHead; ps != nullptr; ps = ps->NextQuadrantEntry)
+            {
+                AddPaintStruct(images, ps);
+            }
+            PaintSessionFree(session);
+        }
+        return images;
+    }
+
+private:
+    static std::shared_ptr<IContext> _context;
+};
+
+std::shared_ptr<IContext> PaintTileCacheTests::_context;
+
+TEST_F(PaintTileCacheTests, CachedTilesPaintTheSame)
+{
+    static constexpr uint32_t kViewFlags[] = {
+        VIEWPORT_FLAG_NONE,
+        VIEWPORT_FLAG_UNDERGROUND_INSIDE,
+        VIEWPORT_FLAG_HIDE_VEGETATION | VIEWPORT_FLAG_HIDE_SCENERY | VIEWPORT_FLAG_HIDE_PATHS,
+    };
+    for (auto zoom = ZoomLevel{ 0 }; zoom <= ZoomLevel{ 2 }; zoom++)
+    {
+        for (uint8_t rotation = 0; rotation < 4; rotation++)
+        {
+            for (auto flags : kViewFlags)
+            {
+                const auto viewport = GetViewport(zoom, rotation, flags);
+
+                PaintTileCacheSetEnabled(false);
+                const auto expectedView = PaintView(viewport, 1);
+                const auto expectedSplit = PaintView(viewport, 2);
+                ASSERT_FALSE(expectedView.empty());
+
+                // The first paint records the tiles and the second replays them. Splitting the columns replays the
+                // same recordings into narrower sessions, culling part of each one.
+                PaintTileCacheSetEnabled(true);
+                ASSERT_EQ(PaintView(viewport, 1), expectedView)
+                    << "zoom " << static_cast<int32_t>(static_cast<int8_t>(zoom)) << ", rotation " << +rotation
+                    << ", flags " << flags << ", recording";
+                ASSERT_EQ(PaintView(viewport, 1), expectedView)
+                    << "zoom " << static_cast<int32_t>(static_cast<int8_t>(zoom)) << ", rotation " << +rotation
+                    << ", flags " << flags << ", replaying";
+                ASSERT_EQ(PaintView(viewport, 2), expectedSplit)
+                    << "zoom " << static_cast<int32_t>(static_cast<int8_t>(zoom)) << ", rotation " << +rotation
+                    << ", flags " << flags << ", replaying into split columns";
+            }
+        }
+    }
+}
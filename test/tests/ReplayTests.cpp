@@ -18,10 +18,14 @@
 #include <openrct2/audio/AudioContext.h>
 #include <openrct2/core/File.h>
 #include <openrct2/core/FileScanner.h>
+#include <openrct2/core/Json.hpp>
 #include <openrct2/core/Path.hpp>
 #include <openrct2/core/String.hpp>
+#include <openrct2/core/Timer.hpp>
 #include <openrct2/platform/Platform.h>
 #include <openrct2/ride/Ride.h>
+#include <iostream>
+#include <optional>
 #include <string>
 
 using namespace OpenRCT2;
@@ -97,6 +101,114 @@ TEST_P(ReplayTests, RunReplay)
     ASSERT_FALSE(replayManager->IsPlaybackStateMismatching());
 }
 
+// Replay benchmarks are opt-in, see REPLAY_BENCHMARKS in CMakeLists.txt. The configuration file holds:
+//   output     directory to write one <replay>.json result file to per replay
+//   baseline   directory of result files from an earlier run to compare against, optional
+//   threshold  allowed tick rate and peak memory regression in percent
+// Peak memory is measured per process, so each replay must run in its own process, as ctest does.
+// Every replay in testdata/replays is benchmarked. The downloaded replays are short and of small parks, so large-park
+// replays have to be added there for the numbers to say much about simulation cost.
+static constexpr const char* kReplayBenchmarkConfigFile = "replay-benchmarks.json";
+
+struct ReplayBenchmarkSettings
+{
+    std::string outputDirectory;
+    std::string baselineDirectory;
+    double thresholdPercent = 10.0;
+};
+
+static std::optional<ReplayBenchmarkSettings> GetReplayBenchmarkSettings()
+{
+    if (!File::Exists(kReplayBenchmarkConfigFile))
+        return std::nullopt;
+
+    auto config = Json::ReadFromFile(kReplayBenchmarkConfigFile);
+
+    ReplayBenchmarkSettings settings;
+    settings.outputDirectory = Json::GetString(config["output"]);
+    settings.baselineDirectory = Json::GetString(config["baseline"]);
+    settings.thresholdPercent = Json::GetNumber<double>(config["threshold"], settings.thresholdPercent);
+    return settings;
+}
+
+TEST_P(ReplayTests, BenchmarkReplay)
+{
+    auto settings = GetReplayBenchmarkSettings();
+    if (!settings.has_value())
+    {
+        GTEST_SKIP() << "Replay benchmarks are disabled";
+    }
+
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    auto testData = GetParam();
+
+    auto context = CreateContext();
+    bool initialised = context->Initialise();
+    ASSERT_TRUE(initialised);
+
+    IReplayManager* replayManager = context->GetReplayManager();
+    ASSERT_NE(replayManager, nullptr);
+
+    bool startedReplay = replayManager->StartPlayback(testData.filePath);
+    ASSERT_TRUE(startedReplay);
+
+    uint32_t ticks = 0;
+    Timer timer;
+    while (replayManager->IsReplaying())
+    {
+        gameStateUpdateLogic();
+        ticks++;
+        if (replayManager->IsPlaybackStateMismatching())
+            break;
+    }
+    const auto seconds = timer.GetElapsedTime().count();
+    ASSERT_FALSE(replayManager->IsReplaying());
+    ASSERT_FALSE(replayManager->IsPlaybackStateMismatching());
+
+    const auto ticksPerSecond = seconds > 0 ? ticks / seconds : 0.0;
+    const auto peakMemory = Platform::GetPeakMemoryUsage();
+
+    json_t result = {
+        { "ticks", ticks },
+        { "seconds", seconds },
+        { "ticksPerSecond", ticksPerSecond },
+        { "peakMemory", peakMemory },
+    };
+    std::cout << testData.name << ": " << result.dump() << std::endl;
+
+    const auto resultFileName = testData.name + ".json";
+    if (!settings->outputDirectory.empty())
+    {
+        Path::CreateDirectory(settings->outputDirectory);
+        Json::WriteToFile(Path::Combine(settings->outputDirectory, resultFileName), result);
+    }
+
+    if (!settings->baselineDirectory.empty())
+    {
+        const auto baselinePath = Path::Combine(settings->baselineDirectory, resultFileName);
+        if (!File::Exists(baselinePath))
+        {
+            GTEST_SKIP() << "No baseline for " << testData.name;
+        }
+
+        auto baseline = Json::ReadFromFile(baselinePath);
+        const auto tolerance = settings->thresholdPercent / 100.0;
+
+        const auto baselineTicksPerSecond = Json::GetNumber<double>(baseline["ticksPerSecond"]);
+        EXPECT_GE(ticksPerSecond, baselineTicksPerSecond * (1.0 - tolerance))
+            << "Tick rate regressed from " << baselineTicksPerSecond << " to " << ticksPerSecond;
+
+        const auto baselinePeakMemory = Json::GetNumber<uint64_t>(baseline["peakMemory"]);
+        if (baselinePeakMemory != 0 && peakMemory != 0)
+        {
+            EXPECT_LE(peakMemory, baselinePeakMemory * (1.0 + tolerance))
+                << "Peak memory regressed from " << baselinePeakMemory << " to " << peakMemory;
+        }
+    }
+}
+
 static void PrintTo(const ReplayTestData& testData, std::ostream* os)
 {
     *os << testData.filePath;
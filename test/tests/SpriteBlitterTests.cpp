@@ -0,0 +1,287 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2025 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <gtest/gtest.h>
+#include <openrct2/drawing/Drawing.h>
+#include <openrct2/interface/Colour.h>
+#include <vector>
+
+static constexpr int32_t kSpriteWidth = 37;
+static constexpr int32_t kSpriteHeight = 23;
+
+// Blend ops paired with image flags that select them, kBlendNone is only used by opaque bitmaps.
+static constexpr DrawBlendOp kBlendOps[] = {
+    kBlendNone,
+    kBlendTransparent,
+    kBlendTransparent | kBlendSrc,
+    kBlendTransparent | kBlendDst,
+    kBlendTransparent | kBlendSrc | kBlendDst,
+};
+
+static ImageId GetImageForBlendOp(DrawBlendOp op)
+{
+    auto image = ImageId(0);
+    if (op & kBlendSrc)
+        image = image.WithPrimary(COLOUR_BRIGHT_RED);
+    return image.WithBlended((op & kBlendDst) != 0);
+}
+
+class SpriteBlitterTests : public testing::Test
+{
+protected:
+    // Dense copy of the test sprite, 0 is transparent.
+    std::vector<uint8_t> _pixels;
+    std::vector<uint8_t> _rle;
+    std::vector<uint8_t> _paletteData;
+
+    void SetUp() override
+    {
+        _pixels.resize(kSpriteWidth * kSpriteHeight);
+        for (int32_t y = 0; y < kSpriteHeight; y++)
+        {
+            for (int32_t x = 0; x < kSpriteWidth; x++)
+            {
+                // Leave gaps of varying length so the RLE data has several runs per line.
+                auto value = ((x * 7) + (y * 13)) % 256;
+                _pixels[y * kSpriteWidth + x] = ((x + y) % 5 == 0 || (x / 4 + y) % 3 == 0) ? 0 : std::max(value, 1);
+            }
+        }
+        _rle = EncodeRLE(_pixels);
+
+        // Palette maps used for both remapping (first 256 entries) and blending (all 256 * 256 entries).
+        _paletteData.resize(256 * 256);
+        for (size_t i = 0; i < _paletteData.size(); i++)
+        {
+            _paletteData[i] = static_cast<uint8_t>((i * 31) + 7);
+        }
+    }
+
+    static std::vector<uint8_t> EncodeRLE(const std::vector<uint8_t>& pixels)
+    {
+        std::vector<uint8_t> lines;
+        std::vector<uint8_t> result(kSpriteHeight * sizeof(uint16_t));
+        for (int32_t y = 0; y < kSpriteHeight; y++)
+        {
+            auto lineOffset = static_cast<uint16_t>(result.size() + lines.size());
+            result[y * 2] = lineOffset & 0xFF;
+            result[y * 2 + 1] = lineOffset >> 8;
+
+            const auto* row = &pixels[y * kSpriteWidth];
+            size_t lastRunHeader = SIZE_MAX;
+            for (int32_t x = 0; x < kSpriteWidth;)
+            {
+                if (row[x] == 0)
+                {
+                    x++;
+                    continue;
+                }
+                auto start = x;
+                while (x < kSpriteWidth && row[x] != 0 && x - start < 0x7F)
+                    x++;
+                lastRunHeader = lines.size();
+                lines.push_back(static_cast<uint8_t>(x - start));
+                lines.push_back(static_cast<uint8_t>(start));
+                lines.insert(lines.end(), row + start, row + x);
+            }
+            if (lastRunHeader == SIZE_MAX)
+            {
+                lastRunHeader = lines.size();
+                lines.push_back(0);
+                lines.push_back(0);
+            }
+            lines[lastRunHeader] |= 0x80;
+        }
+        result.insert(result.end(), lines.begin(), lines.end());
+        return result;
+    }
+
+    G1Element GetElement(bool rle)
+    {
+        G1Element g1{};
+        g1.offset = rle ? _rle.data() : _pixels.data();
+        g1.width = kSpriteWidth;
+        g1.height = kSpriteHeight;
+        g1.flags = rle ? G1_FLAG_RLE_COMPRESSION : G1_FLAG_HAS_TRANSPARENCY;
+        return g1;
+    }
+
+    PaletteMap GetPaletteMap()
+    {
+        return PaletteMap(_paletteData.data(), 256, 256);
+    }
+
+    // Straightforward per pixel version of what every kernel is expected to produce.
+    void DrawReference(
+        std::vector<uint8_t>& dst, int32_t dstWidth, ZoomLevel zoom, DrawBlendOp op, bool rle, int32_t srcX, int32_t srcY,
+        int32_t width, int32_t height)
+    {
+        auto paletteMap = GetPaletteMap();
+        auto blit = [&](int32_t sx, int32_t sy, uint8_t* d) {
+            const auto* s = &_pixels[sy * kSpriteWidth + sx];
+            // RLE sprites never write the gaps between runs, bitmaps rely on the blend op.
+            if (rle && *s == 0)
+                return;
+            switch (op)
+            {
+                case kBlendNone:
+                    BlitPixel<kBlendNone>(s, d, paletteMap);
+                    break;
+                case kBlendTransparent:
+                    BlitPixel<kBlendTransparent>(s, d, paletteMap);
+                    break;
+                case kBlendTransparent | kBlendSrc:
+                    BlitPixel<kBlendTransparent | kBlendSrc>(s, d, paletteMap);
+                    break;
+                case kBlendTransparent | kBlendDst:
+                    BlitPixel<kBlendTransparent | kBlendDst>(s, d, paletteMap);
+                    break;
+                case kBlendTransparent | kBlendSrc | kBlendDst:
+                    BlitPixel<kBlendTransparent | kBlendSrc | kBlendDst>(s, d, paletteMap);
+                    break;
+            }
+        };
+
+        if (zoom < ZoomLevel{ 0 })
+        {
+            for (int32_t y = 0; y < height; y++)
+            {
+                for (int32_t x = 0; x < width; x++)
+                {
+                    blit(zoom.ApplyTo(srcX + x), zoom.ApplyTo(srcY + y), &dst[y * dstWidth + x]);
+                }
+            }
+        }
+        else
+        {
+            const auto step = zoom.ApplyTo(1);
+            for (int32_t y = 0; y * step < height; y++)
+            {
+                for (int32_t x = 0; x * step < width; x++)
+                {
+                    blit(srcX + x * step, srcY + y * step, &dst[y * dstWidth + x]);
+                }
+            }
+        }
+    }
+
+    struct Case
+    {
+        int32_t SrcX;
+        int32_t SrcY;
+        int32_t Width;
+        int32_t Height;
+    };
+
+    // The source area drawn for each zoom level, both from the sprite origin and clipped.
+    static std::vector<Case> GetCases(ZoomLevel zoom)
+    {
+        if (zoom < ZoomLevel{ 0 })
+        {
+            auto w = zoom.ApplyInversedTo(kSpriteWidth);
+            auto h = zoom.ApplyInversedTo(kSpriteHeight);
+            return { { 0, 0, w, h }, { 5, 3, w - 5, h - 3 }, { 0, 2, w - 9, h - 7 } };
+        }
+        return { { 0, 0, kSpriteWidth, kSpriteHeight }, { 3, 2, kSpriteWidth - 3, kSpriteHeight - 2 } };
+    }
+};
+
+TEST_F(SpriteBlitterTests, MatchesReference)
+{
+    for (auto rle : { false, true })
+    {
+        auto g1 = GetElement(rle);
+        for (auto op : kBlendOps)
+        {
+            // Opaque bitmaps have no RLE equivalent.
+            if (rle && op == kBlendNone)
+                continue;
+
+            auto element = g1;
+            if (!rle && op == kBlendNone)
+                element.flags &= ~G1_FLAG_HAS_TRANSPARENCY;
+
+            for (auto zoom = ZoomLevel::min(); zoom <= ZoomLevel::max(); zoom++)
+            {
+                for (const auto& c : GetCases(zoom))
+                {
+                    constexpr int32_t kDstWidth = 160;
+                    constexpr int32_t kDstHeight = 100;
+                    std::vector<uint8_t> expected(kDstWidth * kDstHeight);
+                    for (size_t i = 0; i < expected.size(); i++)
+                    {
+                        expected[i] = static_cast<uint8_t>(i * 3);
+                    }
+                    auto actual = expected;
+
+                    DrawPixelInfo dpi{};
+                    dpi.bits = actual.data();
+                    dpi.width = kDstWidth;
+                    dpi.height = kDstHeight;
+                    dpi.zoom_level = zoom;
+
+                    DrawSpriteArgs args(
+                        GetImageForBlendOp(op), GetPaletteMap(), element, c.SrcX, c.SrcY, c.Width, c.Height, actual.data());
+                    GfxSpriteToBuffer(dpi, args);
+                    DrawReference(expected, kDstWidth, zoom, op, rle, c.SrcX, c.SrcY, c.Width, c.Height);
+
+                    ASSERT_EQ(actual, expected) << "rle: " << rle << ", blend op: " << static_cast<int32_t>(op)
+                                                << ", zoom: " << static_cast<int32_t>(static_cast<int8_t>(zoom))
+                                                << ", src: " << c.SrcX << "," << c.SrcY;
+                }
+            }
+        }
+    }
+}
+
+// Not a pass/fail test, prints the cost of drawing the test sprite with each kernel. Disabled by default, run it with
+// `OpenRCT2Tests --gtest_also_run_disabled_tests --gtest_filter=SpriteBlitterTests.DISABLED_BlitterCost`.
+TEST_F(SpriteBlitterTests, DISABLED_BlitterCost)
+{
+    constexpr int32_t kIterations = 2000;
+    constexpr int32_t kDstWidth = 160;
+    std::vector<uint8_t> buffer(kDstWidth * 100);
+    for (auto rle : { false, true })
+    {
+        auto g1 = GetElement(rle);
+        for (auto op : kBlendOps)
+        {
+            if (rle && op == kBlendNone)
+                continue;
+
+            auto element = g1;
+            if (!rle && op == kBlendNone)
+                element.flags &= ~G1_FLAG_HAS_TRANSPARENCY;
+
+            for (auto zoom = ZoomLevel::min(); zoom <= ZoomLevel::max(); zoom++)
+            {
+                const auto c = GetCases(zoom)[0];
+                DrawPixelInfo dpi{};
+                dpi.bits = buffer.data();
+                dpi.width = kDstWidth;
+                dpi.height = 100;
+                dpi.zoom_level = zoom;
+                DrawSpriteArgs args(
+                    GetImageForBlendOp(op), GetPaletteMap(), element, c.SrcX, c.SrcY, c.Width, c.Height, buffer.data());
+
+                auto start = std::chrono::steady_clock::now();
+                for (int32_t i = 0; i < kIterations; i++)
+                {
+                    GfxSpriteToBuffer(dpi, args);
+                }
+                auto duration = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start);
+                std::printf(
+                    "%s blend op %d zoom %d: %.1f ns\n", rle ? "rle" : "bmp", op, static_cast<int8_t>(zoom),
+                    duration.count() / kIterations);
+            }
+        }
+    }
+}
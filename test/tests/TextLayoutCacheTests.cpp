@@ -0,0 +1,140 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2025 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <memory>
+#include <openrct2/Context.h>
+#include <openrct2/OpenRCT2.h>
+#include <openrct2/drawing/Drawing.h>
+#include <openrct2/drawing/Font.h>
+#include <openrct2/localisation/Language.h>
+#include <string>
+#include <vector>
+
+using namespace OpenRCT2;
+
+static constexpr int32_t kClipWidth = 150;
+static constexpr int32_t kWrapWidth = 300;
+
+struct TextLayout
+{
+    int32_t Width;
+    std::string Clipped;
+    int32_t ClippedWidth;
+    std::string Wrapped;
+    int32_t WrappedWidth;
+    int32_t NumLines;
+
+    bool operator==(const TextLayout& other) const = default;
+};
+
+class TextLayoutCacheTests : public testing::Test
+{
+protected:
+    static void SetUpTestCase()
+    {
+        gOpenRCT2Headless = true;
+        // The sprite font widths are read from g1, so the sprites have to be loaded.
+        gOpenRCT2NoGraphics = false;
+        _context = CreateContext();
+        ASSERT_TRUE(_context->Initialise());
+
+        LanguageOpen(LANGUAGE_ENGLISH_UK);
+    }
+
+    static void TearDownTestCase()
+    {
+        _context = {};
+    }
+
+    // Lines like those in a guest list, some wider than the clip width, and a few paragraphs like news items.
+    static std::vector<std::string> GetTexts()
+    {
+        static constexpr const char* kNames[] = { "Guest", "Peter", "Alice", "Chris", "Dana", "Oliver", "Priya", "Sam" };
+        std::vector<std::string> texts;
+        for (int32_t i = 0; i < 200; i++)
+        {
+            texts.push_back(std::string(kNames[i % 8]) + " " + std::to_string(1000 + i * 37) + " is walking to the Maze");
+        }
+        for (int32_t i = 0; i < 5; i++)
+        {
+            std::string paragraph;
+            for (int32_t word = 0; word < 40; word++)
+            {
+                paragraph += std::string(kNames[(i + word) % 8]) + (word % 3 == 0 ? "s " : " ");
+            }
+            texts.push_back(paragraph);
+        }
+        return texts;
+    }
+
+    static TextLayout GetLayout(const std::string& text, FontStyle fontStyle)
+    {
+        TextLayout layout{};
+        layout.Width = GfxGetStringWidth(text, fontStyle);
+
+        layout.Clipped = text;
+        layout.ClippedWidth = GfxClipString(layout.Clipped.data(), kClipWidth, fontStyle);
+        layout.Clipped.resize(std::strlen(layout.Clipped.c_str()));
+
+        layout.WrappedWidth = GfxWrapString(text, kWrapWidth, fontStyle, &layout.Wrapped, &layout.NumLines);
+        return layout;
+    }
+
+private:
+    static std::unique_ptr<IContext> _context;
+};
+
+std::unique_ptr<IContext> TextLayoutCacheTests::_context;
+
+TEST_F(TextLayoutCacheTests, CachedLayoutsMatch)
+{
+    for (auto fontStyle : FontStyles)
+    {
+        for (const auto& text : GetTexts())
+        {
+            GfxInvalidateTextLayoutCache();
+            const auto expected = GetLayout(text, fontStyle);
+            ASSERT_GT(expected.Width, 0) << text;
+            ASSERT_EQ(GetLayout(text, fontStyle), expected) << text;
+        }
+    }
+}
+
+// Not a pass/fail test, prints the cost of measuring, clipping and wrapping a window's worth of text each frame with
+// the cache kept and with it dropped every frame. Disabled by default, run it with
+// `OpenRCT2Tests --gtest_also_run_disabled_tests --gtest_filter=TextLayoutCacheTests.DISABLED_LayoutCost`.
+TEST_F(TextLayoutCacheTests, DISABLED_LayoutCost)
+{
+    constexpr int32_t kFrames = 500;
+    const auto texts = GetTexts();
+    for (auto keepCache : { false, true })
+    {
+        int64_t total = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int32_t i = 0; i < kFrames; i++)
+        {
+            if (!keepCache)
+            {
+                GfxInvalidateTextLayoutCache();
+            }
+            for (const auto& text : texts)
+            {
+                total += GetLayout(text, FontStyle::Medium).Width;
+            }
+        }
+        auto duration = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start);
+        std::printf(
+            "%s: %.1f us per frame (%lld)\n", keepCache ? "cached" : "uncached", duration.count() / kFrames,
+            static_cast<long long>(total / kFrames));
+    }
+}
@@ -0,0 +1,128 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2025 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TestData.h"
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <memory>
+#include <openrct2/Context.h>
+#include <openrct2/Game.h>
+#include <openrct2/GameState.h>
+#include <openrct2/OpenRCT2.h>
+#include <openrct2/drawing/Drawing.h>
+#include <openrct2/drawing/X8DrawingEngine.h>
+#include <openrct2/interface/Viewport.h>
+#include <openrct2/world/Map.h>
+#include <vector>
+
+using namespace OpenRCT2;
+using namespace OpenRCT2::Drawing;
+
+static constexpr int32_t kViewWidth = 1024;
+static constexpr int32_t kViewHeight = 768;
+
+// Not a divisor of the view height, so the last strip is shorter and strip edges fall at odd rows.
+static constexpr int32_t kStripHeight = 37;
+
+class ViewportStripPainterTests : public testing::Test
+{
+protected:
+    static void SetUpTestCase()
+    {
+        std::string parkPath = TestData::GetParkPath("bpb.sv6");
+        gOpenRCT2Headless = true;
+        // Nothing is drawn for images that are not loaded, so the sprites have to be.
+        gOpenRCT2NoGraphics = false;
+        _context = CreateContext();
+        bool initialised = _context->Initialise();
+        ASSERT_TRUE(initialised);
+
+        GetContext()->LoadParkFromFile(parkPath);
+        GameLoadInit();
+        SUCCEED();
+    }
+
+    static void TearDownTestCase()
+    {
+        if (_context)
+            _context.reset();
+    }
+
+    static Viewport GetViewport(ZoomLevel zoom, uint8_t rotation)
+    {
+        const auto& mapSize = GetGameState().MapSize;
+        const CoordsXY centre = { (mapSize.x / 2) * kCoordsXYStep + 16, (mapSize.y / 2) * kCoordsXYStep + 16 };
+        const auto centre2d = Translate3DTo2DWithZ(rotation, { centre, TileElementHeight(centre) });
+
+        Viewport viewport{};
+        viewport.width = kViewWidth;
+        viewport.height = kViewHeight;
+        viewport.zoom = zoom;
+        viewport.rotation = rotation;
+        viewport.viewPos = { centre2d.x - (viewport.ViewWidth() / 2), centre2d.y - (viewport.ViewHeight() / 2) };
+        return viewport;
+    }
+
+    static std::vector<uint8_t> RenderFull(IDrawingEngine& drawingEngine, const Viewport& viewport)
+    {
+        std::vector<uint8_t> pixels(kViewWidth * kViewHeight);
+        DrawPixelInfo dpi{};
+        dpi.DrawingEngine = &drawingEngine;
+        dpi.bits = pixels.data();
+        dpi.width = kViewWidth;
+        dpi.height = kViewHeight;
+
+        ResetAllSpriteQuadrantPlacements();
+        ViewportRender(dpi, &viewport);
+        return pixels;
+    }
+
+    static std::vector<uint8_t> RenderStrips(IDrawingEngine& drawingEngine, const Viewport& viewport)
+    {
+        std::vector<uint8_t> pixels(kViewWidth * kViewHeight);
+        std::vector<uint8_t> strip(kViewWidth * kStripHeight);
+
+        ResetAllSpriteQuadrantPlacements();
+        ViewportStripPainter painter(viewport, drawingEngine);
+        for (int32_t y = 0; y < kViewHeight; y += kStripHeight)
+        {
+            DrawPixelInfo dpi{};
+            dpi.DrawingEngine = &drawingEngine;
+            dpi.bits = strip.data();
+            dpi.y = y;
+            dpi.width = kViewWidth;
+            dpi.height = std::min(kStripHeight, kViewHeight - y);
+            painter.Draw(dpi);
+            std::copy_n(strip.begin(), kViewWidth * dpi.height, pixels.begin() + y * kViewWidth);
+        }
+        return pixels;
+    }
+
+private:
+    static std::shared_ptr<IContext> _context;
+};
+
+std::shared_ptr<IContext> ViewportStripPainterTests::_context;
+
+TEST_F(ViewportStripPainterTests, StripsMatchFullRender)
+{
+    X8DrawingEngine drawingEngine(GetContext()->GetUiContext());
+    for (auto zoom = ZoomLevel{ 0 }; zoom <= ZoomLevel{ 2 }; zoom++)
+    {
+        for (uint8_t rotation = 0; rotation < 4; rotation++)
+        {
+            const auto viewport = GetViewport(zoom, rotation);
+            const auto expected = RenderFull(drawingEngine, viewport);
+            ASSERT_TRUE(std::any_of(expected.begin(), expected.end(), [](uint8_t pixel) { return pixel != 0; }));
+            ASSERT_EQ(RenderStrips(drawingEngine, viewport), expected)
+                << "zoom " << static_cast<int32_t>(static_cast<int8_t>(zoom)) << ", rotation " << +rotation;
+        }
+    }
+}